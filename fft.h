@@ -84,6 +84,9 @@ mp_limb_t mpn_sumdiff_n(mp_ptr s, mp_ptr d, mp_srcptr x, mp_srcptr y, mp_size_t
    (n == 0 ? 0 : mpn_sumdiff_n(t, u, r, s, n))
 
 
+/* transforms of at least this many limbs use the global thread pool */
+#define FFT_THREADED_CUTOFF 16384
+
 #define SWAP_PTRS(xx, yy) \
    do { \
       mp_limb_t * __ptr = xx; \
@@ -242,6 +245,11 @@ FLINT_DLL void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n,
                         flint_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
                                 mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc);
 
+FLINT_DLL mp_limb_t ** _fft_thread_temps_init(slong num, mp_size_t limbs);
+
+FLINT_DLL void _fft_thread_temps_clear(mp_limb_t ** ii, mp_limb_t ** jj,
+                 mp_size_t len, mp_limb_t ** t, slong num, mp_size_t limbs);
+
 FLINT_DLL void fft_negacyclic(mp_limb_t ** ii, mp_size_t n, flint_bitcnt_t w, 
                              mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** temp);
 
@@ -259,6 +267,13 @@ FLINT_DLL slong fft_adjust_limbs(mp_size_t limbs);
 FLINT_DLL void fft_mulmod_2expp1(mp_limb_t * r, mp_limb_t * i1, mp_limb_t * i2, 
                                         mp_size_t n, mp_size_t w, mp_limb_t * tt);
 
+FLINT_DLL void fft_mulmod_2expm1(mp_ptr r, mp_srcptr i1, mp_size_t n1,
+                       mp_srcptr i2, mp_size_t n2, flint_bitcnt_t bits,
+                                      flint_bitcnt_t depth, flint_bitcnt_t w);
+
+FLINT_DLL mp_size_t fft_mulmod_2expm1_params(flint_bitcnt_t * depth,
+                  flint_bitcnt_t * w, mp_size_t len, flint_bitcnt_t bits);
+
 FLINT_DLL void flint_mpn_mul_fft_main(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
                         mp_srcptr i2, mp_size_t n2);
 
@@ -266,6 +281,13 @@ FLINT_DLL void fft_convolution(mp_limb_t ** ii, mp_limb_t ** jj, slong depth,
                                  slong limbs, slong trunc, mp_limb_t ** t1, 
                                 mp_limb_t ** t2, mp_limb_t ** s1, mp_limb_t ** tt);
 
+FLINT_DLL void fft_precache(mp_limb_t ** jj, slong depth, slong limbs,
+              slong trunc, mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** s1);
+
+FLINT_DLL void fft_convolution_precache(mp_limb_t ** ii, mp_limb_t ** jj,
+                  slong depth, slong limbs, slong trunc, mp_limb_t ** t1,
+                          mp_limb_t ** t2, mp_limb_t ** s1, mp_limb_t ** tt);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,121 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fft.h"
+
+void fft_precache(mp_limb_t ** jj, slong depth, slong limbs, slong trunc,
+                  mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** s1)
+{
+   slong n = (WORD(1)<<depth), j;
+   slong w = (limbs*FLINT_BITS)/n;
+   slong sqrt = (WORD(1)<<(depth/2));
+
+   if (depth <= 6)
+   {
+      trunc = 2*((trunc + 1)/2);
+
+      fft_truncate_sqrt2(jj, n, w, t1, t2, s1, trunc);
+
+      for (j = 0; j < trunc; j++)
+         mpn_normmod_2expp1(jj[j], limbs);
+   } else
+   {
+      slong n1 = sqrt, n2 = (2*n)/n1, i, s, trunc2;
+      flint_bitcnt_t depth2 = 0;
+
+      trunc = 2*sqrt*((trunc + 2*sqrt - 1)/(2*sqrt));
+      trunc2 = (trunc - 2*n)/n1;
+
+      while ((UWORD(1)<<depth2) < n2) depth2++;
+
+      fft_mfa_truncate_sqrt2_outer(jj, n, w, t1, t2, s1, sqrt, trunc);
+
+      /* the row transforms done by fft_mfa_truncate_sqrt2_inner */
+      for (i = 0; i < n2; i++)
+      {
+         fft_radix2(jj + i*n1, n1/2, w*n2, t1, t2);
+         for (j = 0; j < n1; j++)
+            mpn_normmod_2expp1(jj[i*n1 + j], limbs);
+      }
+
+      for (s = 0; s < trunc2; s++)
+      {
+         i = 2*n/n1 + n_revbin(s, depth2);
+         fft_radix2(jj + i*n1, n1/2, w*n2, t1, t2);
+         for (j = 0; j < n1; j++)
+            mpn_normmod_2expp1(jj[i*n1 + j], limbs);
+      }
+   }
+}
+
+void fft_convolution_precache(mp_limb_t ** ii, mp_limb_t ** jj, slong depth,
+                              slong limbs, slong trunc, mp_limb_t ** t1,
+                          mp_limb_t ** t2, mp_limb_t ** s1, mp_limb_t ** tt)
+{
+   slong n = (WORD(1)<<depth), j;
+   slong w = (limbs*FLINT_BITS)/n;
+   slong sqrt = (WORD(1)<<(depth/2));
+
+   if (depth <= 6)
+   {
+      trunc = 2*((trunc + 1)/2);
+
+      fft_truncate_sqrt2(ii, n, w, t1, t2, s1, trunc);
+
+      for (j = 0; j < trunc; j++)
+      {
+         mpn_normmod_2expp1(ii[j], limbs);
+         fft_mulmod_2expp1(ii[j], ii[j], jj[j], n, w, *tt);
+      }
+
+      ifft_truncate_sqrt2(ii, n, w, t1, t2, s1, trunc);
+
+      for (j = 0; j < trunc; j++)
+      {
+         mpn_div_2expmod_2expp1(ii[j], ii[j], limbs, depth + 2);
+         mpn_normmod_2expp1(ii[j], limbs);
+      }
+   } else
+   {
+      slong n1 = sqrt, n2 = (2*n)/n1, i, s, t, trunc2;
+      flint_bitcnt_t depth2 = 0;
+
+      trunc = 2*sqrt*((trunc + 2*sqrt - 1)/(2*sqrt));
+      trunc2 = (trunc - 2*n)/n1;
+
+      while ((UWORD(1)<<depth2) < n2) depth2++;
+
+      fft_mfa_truncate_sqrt2_outer(ii, n, w, t1, t2, s1, sqrt, trunc);
+
+      /* as fft_mfa_truncate_sqrt2_inner, but jj is already transformed */
+      for (s = 0; s < trunc2 + n2; s++)
+      {
+         i = (s < trunc2) ? 2*n/n1 + n_revbin(s, depth2) : s - trunc2;
+
+         fft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
+
+         for (j = 0; j < n1; j++)
+         {
+            t = i*n1 + j;
+            mpn_normmod_2expp1(ii[t], limbs);
+            fft_mulmod_2expp1(ii[t], ii[t], jj[t], n, w, *tt);
+         }
+
+         ifft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
+      }
+
+      ifft_mfa_truncate_sqrt2_outer(ii, n, w, t1, t2, s1, sqrt, trunc);
+   }
+}
@@ -13,6 +13,7 @@
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fft.h"
+#include "thread_pool.h"
       
 void fft_butterfly_twiddle(mp_limb_t * u, mp_limb_t * v, 
     mp_limb_t * s, mp_limb_t * t, mp_size_t limbs, flint_bitcnt_t b1, flint_bitcnt_t b2)
@@ -218,49 +219,47 @@ void fft_mfa_truncate_sqrt2(mp_limb_t ** ii, mp_size_t n,
    }
 }
 
-void fft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, 
-                   flint_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
-                             mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
+typedef struct
 {
-   mp_size_t i, j;
-   mp_size_t n2 = (2*n)/n1;
-   mp_size_t trunc2 = (trunc - 2*n)/n1;
-   mp_size_t limbs = (n*w)/FLINT_BITS;
-   flint_bitcnt_t depth = 0;
-   flint_bitcnt_t depth2 = 0;
-   int k = 0;
+   mp_limb_t ** ii;
+   mp_size_t n, n1, n2, trunc, trunc2, limbs, start, step;
+   flint_bitcnt_t w, depth;
+   mp_limb_t ** t1, ** t2, ** temp;
+} fft_outer_arg_t;
 
-   while ((UWORD(1)<<depth) < n2) depth++;
-   while ((UWORD(1)<<depth2) < n1) depth2++;
+/* first half matrix fourier FFT : n2 rows, n1 cols */
+static void _fft_outer1_worker(void * arg_ptr)
+{
+   fft_outer_arg_t * arg = (fft_outer_arg_t *) arg_ptr;
+   mp_limb_t ** ii = arg->ii;
+   mp_size_t n = arg->n, n1 = arg->n1, n2 = arg->n2;
+   mp_size_t trunc = arg->trunc, limbs = arg->limbs;
+   flint_bitcnt_t w = arg->w, depth = arg->depth;
+   mp_limb_t ** t1 = arg->t1, ** t2 = arg->t2, ** temp = arg->temp;
+   mp_size_t i, j;
 
-   /* first half matrix fourier FFT : n2 rows, n1 cols */
-   
    /* FFTs on columns */
 
-#pragma omp parallel for private(i, j, k)
-   for (i = 0; i < n1; i++)
+   for (i = arg->start; i < n1; i += arg->step)
    {   
-#if HAVE_OPENMP
-      k = omp_get_thread_num();
-#endif
       /* relevant part of first layer of full sqrt2 FFT */
       if (w & 1)
       {
          for (j = i; j < trunc - 2*n; j+=n1) 
          {   
             if (j & 1)
-               fft_butterfly_sqrt2(t1[k], t2[k], ii[j], ii[2*n+j], j, limbs, w, temp[k]);
+               fft_butterfly_sqrt2(*t1, *t2, ii[j], ii[2*n+j], j, limbs, w, *temp);
             else
-               fft_butterfly(t1[k], t2[k], ii[j], ii[2*n+j], j/2, limbs, w);     
+               fft_butterfly(*t1, *t2, ii[j], ii[2*n+j], j/2, limbs, w);     
 
-            SWAP_PTRS(ii[j],     t1[k]);
-            SWAP_PTRS(ii[2*n+j], t2[k]);
+            SWAP_PTRS(ii[j],     *t1);
+            SWAP_PTRS(ii[2*n+j], *t2);
          }
 
          for ( ; j < 2*n; j+=n1)
          {
              if (i & 1)
-                fft_adjust_sqrt2(ii[j + 2*n], ii[j], j, limbs, w, temp[k]); 
+                fft_adjust_sqrt2(ii[j + 2*n], ii[j], j, limbs, w, *temp); 
              else
                 fft_adjust(ii[j + 2*n], ii[j], j/2, limbs, w); 
          }
@@ -268,10 +267,10 @@ void fft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n,
       {
          for (j = i; j < trunc - 2*n; j+=n1) 
          {   
-            fft_butterfly(t1[k], t2[k], ii[j], ii[2*n+j], j, limbs, w/2);
+            fft_butterfly(*t1, *t2, ii[j], ii[2*n+j], j, limbs, w/2);
    
-            SWAP_PTRS(ii[j],     t1[k]);
-            SWAP_PTRS(ii[2*n+j], t2[k]);
+            SWAP_PTRS(ii[j],     *t1);
+            SWAP_PTRS(ii[2*n+j], *t2);
          }
 
          for ( ; j < 2*n; j+=n1)
@@ -283,31 +282,35 @@ void fft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n,
          of 1 starting at row 0, where z => w bits
       */
       
-      fft_radix2_twiddle(ii + i, n1, n2/2, w*n1, t1 + k, t2 + k, w, 0, i, 1);
+      fft_radix2_twiddle(ii + i, n1, n2/2, w*n1, t1, t2, w, 0, i, 1);
       for (j = 0; j < n2; j++)
       {
          mp_size_t s = n_revbin(j, depth);
          if (j < s) SWAP_PTRS(ii[i+j*n1], ii[i+s*n1]);
       }
    }
-      
-   /* second half matrix fourier FFT : n2 rows, n1 cols */
-   ii += 2*n;
+}
+
+/* second half matrix fourier FFT : n2 rows, n1 cols */
+static void _fft_outer2_worker(void * arg_ptr)
+{
+   fft_outer_arg_t * arg = (fft_outer_arg_t *) arg_ptr;
+   mp_limb_t ** ii = arg->ii + 2*arg->n;
+   mp_size_t n1 = arg->n1, n2 = arg->n2, trunc2 = arg->trunc2;
+   flint_bitcnt_t w = arg->w, depth = arg->depth;
+   mp_limb_t ** t1 = arg->t1, ** t2 = arg->t2;
+   mp_size_t i, j;
 
    /* FFTs on columns */
 
-#pragma omp parallel for private(i, j, k)
-   for (i = 0; i < n1; i++)
+   for (i = arg->start; i < n1; i += arg->step)
    {   
-#if HAVE_OPENMP
-      k = omp_get_thread_num();
-#endif
       /*
          FFT of length n2 on column i, applying z^{r*i} for rows going up in steps 
          of 1 starting at row 0, where z => w bits
       */
       
-      fft_truncate1_twiddle(ii + i, n1, n2/2, w*n1, t1 + k, t2 + k, w, 0, i, 1, trunc2);
+      fft_truncate1_twiddle(ii + i, n1, n2/2, w*n1, t1, t2, w, 0, i, 1, trunc2);
       for (j = 0; j < n2; j++)
       {
          mp_size_t s = n_revbin(j, depth);
@@ -315,3 +318,64 @@ void fft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n,
       }
    }
 }
+
+void fft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, 
+                   flint_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                             mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
+{
+   mp_size_t n2 = (2*n)/n1;
+   mp_size_t limbs = (n*w)/FLINT_BITS;
+   flint_bitcnt_t depth = 0;
+   thread_pool_handle * handles = NULL;
+   slong num_handles = 0, k;
+   fft_outer_arg_t * args;
+   mp_limb_t ** t = NULL;
+
+   while ((UWORD(1)<<depth) < n2) depth++;
+
+   if (4*n*limbs >= FFT_THREADED_CUTOFF)
+      num_handles = flint_request_threads(&handles, flint_get_num_threads());
+
+   args = flint_malloc((num_handles + 1)*sizeof(fft_outer_arg_t));
+
+   if (num_handles > 0)
+      t = _fft_thread_temps_init(num_handles, limbs);
+
+   for (k = 0; k <= num_handles; k++)
+   {
+      args[k].ii = ii;
+      args[k].n = n;
+      args[k].n1 = n1;
+      args[k].n2 = n2;
+      args[k].trunc = trunc;
+      args[k].trunc2 = (trunc - 2*n)/n1;
+      args[k].limbs = limbs;
+      args[k].start = k;
+      args[k].step = num_handles + 1;
+      args[k].w = w;
+      args[k].depth = depth;
+
+      /* the calling thread uses the temporaries passed in */
+      args[k].t1 = (k == num_handles) ? t1 : t + k;
+      args[k].t2 = (k == num_handles) ? t2 : t + num_handles + k;
+      args[k].temp = (k == num_handles) ? temp : t + 2*num_handles + k;
+   }
+
+   for (k = 0; k < num_handles; k++)
+      thread_pool_wake(global_thread_pool, handles[k], _fft_outer1_worker, args + k);
+   _fft_outer1_worker(args + num_handles);
+   for (k = 0; k < num_handles; k++)
+      thread_pool_wait(global_thread_pool, handles[k]);
+
+   for (k = 0; k < num_handles; k++)
+      thread_pool_wake(global_thread_pool, handles[k], _fft_outer2_worker, args + k);
+   _fft_outer2_worker(args + num_handles);
+   for (k = 0; k < num_handles; k++)
+      thread_pool_wait(global_thread_pool, handles[k]);
+
+   if (num_handles > 0)
+      _fft_thread_temps_clear(ii, ii, 4*n, t, num_handles, limbs);
+
+   flint_give_back_threads(handles, num_handles);
+   flint_free(args);
+}
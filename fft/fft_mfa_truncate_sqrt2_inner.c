@@ -13,73 +13,101 @@
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fft.h"
+#include "thread_pool.h"
 
-void fft_mfa_truncate_sqrt2_inner(mp_limb_t ** ii, mp_limb_t ** jj, mp_size_t n, 
-                   flint_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
-                  mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, mp_limb_t ** tt)
+typedef struct
 {
-   mp_size_t i, j, s;
-   mp_size_t n2 = (2*n)/n1;
-   mp_size_t trunc2 = (trunc - 2*n)/n1;
-   mp_size_t limbs = (n*w)/FLINT_BITS;
-   flint_bitcnt_t depth = 0;
-   flint_bitcnt_t depth2 = 0;
-   int k = 0;
-
-   while ((UWORD(1)<<depth) < n2) depth++;
-   while ((UWORD(1)<<depth2) < n1) depth2++;
+   mp_limb_t ** ii, ** jj;
+   mp_size_t n, n1, n2, trunc2, limbs, start, step;
+   flint_bitcnt_t w, depth;
+   mp_limb_t ** t1, ** t2, ** tt;
+} fft_inner_arg_t;
 
-   ii += 2*n;
-   jj += 2*n;
+static void _fft_inner_worker(void * arg_ptr)
+{
+   fft_inner_arg_t * arg = (fft_inner_arg_t *) arg_ptr;
+   mp_limb_t ** ii = arg->ii, ** jj = arg->jj;
+   mp_size_t n = arg->n, n1 = arg->n1, n2 = arg->n2;
+   mp_size_t trunc2 = arg->trunc2, limbs = arg->limbs;
+   flint_bitcnt_t w = arg->w, depth = arg->depth;
+   mp_limb_t ** t1 = arg->t1, ** t2 = arg->t2, * tt = *arg->tt;
+   mp_size_t i, j, s;
 
-   /* convolutions on relevant rows */
+   /*
+      convolutions on relevant rows of the second half, then on the rows
+      of the first half, numbered consecutively
+   */
 
-#pragma omp parallel for private(s, i, j, k)
-   for (s = 0; s < trunc2; s++)
+   for (s = arg->start; s < trunc2 + n2; s += arg->step)
    {
-#if HAVE_OPENMP
-      k = omp_get_thread_num();
-#endif
+      i = (s < trunc2) ? 2*n/n1 + n_revbin(s, depth) : s - trunc2;
 
-      i = n_revbin(s, depth);
-      fft_radix2(ii + i*n1, n1/2, w*n2, t1 + k, t2 + k);
-      if (ii != jj) fft_radix2(jj + i*n1, n1/2, w*n2, t1 + k, t2 + k);
+      fft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
+      if (ii != jj) fft_radix2(jj + i*n1, n1/2, w*n2, t1, t2);
       
       for (j = 0; j < n1; j++)
       {
          mp_size_t t = i*n1 + j;
          mpn_normmod_2expp1(ii[t], limbs);
          if (ii != jj) mpn_normmod_2expp1(jj[t], limbs);
-         fft_mulmod_2expp1(ii[t], ii[t], jj[t], n, w, tt[k]);
+         fft_mulmod_2expp1(ii[t], ii[t], jj[t], n, w, tt);
       }      
       
-      ifft_radix2(ii + i*n1, n1/2, w*n2, t1 + k, t2 + k);
+      ifft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
    }
+}
 
-   ii -= 2*n;
-   jj -= 2*n;
+void fft_mfa_truncate_sqrt2_inner(mp_limb_t ** ii, mp_limb_t ** jj, mp_size_t n, 
+                   flint_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                  mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, mp_limb_t ** tt)
+{
+   mp_size_t n2 = (2*n)/n1;
+   mp_size_t limbs = (n*w)/FLINT_BITS;
+   flint_bitcnt_t depth = 0;
+   thread_pool_handle * handles = NULL;
+   slong num_handles = 0, k;
+   fft_inner_arg_t * args;
+   mp_limb_t ** t = NULL;
 
-   /* convolutions on rows */
+   while ((UWORD(1)<<depth) < n2) depth++;
 
-#pragma omp parallel for private(i, j, k)
-   for (i = 0; i < n2; i++)
-   {
-#if HAVE_OPENMP
-      k = omp_get_thread_num();
-#endif
+   if (4*n*limbs >= FFT_THREADED_CUTOFF)
+      num_handles = flint_request_threads(&handles, flint_get_num_threads());
 
-      fft_radix2(ii + i*n1, n1/2, w*n2, t1 + k, t2 + k);
-      if (ii != jj) fft_radix2(jj + i*n1, n1/2, w*n2, t1 + k, t2 + k);
+   args = flint_malloc((num_handles + 1)*sizeof(fft_inner_arg_t));
 
-      for (j = 0; j < n1; j++)
-      {
-         mp_size_t t = i*n1 + j;
-         mpn_normmod_2expp1(ii[t], limbs);
-         if (ii != jj) mpn_normmod_2expp1(jj[t], limbs);
-         fft_mulmod_2expp1(ii[t], ii[t], jj[t], n, w, tt[k]);
-      }      
-      
-      ifft_radix2(ii + i*n1, n1/2, w*n2, t1 + k, t2 + k);
+   if (num_handles > 0)
+      t = _fft_thread_temps_init(num_handles, limbs);
+
+   for (k = 0; k <= num_handles; k++)
+   {
+      args[k].ii = ii;
+      args[k].jj = jj;
+      args[k].n = n;
+      args[k].n1 = n1;
+      args[k].n2 = n2;
+      args[k].trunc2 = (trunc - 2*n)/n1;
+      args[k].limbs = limbs;
+      args[k].start = k;
+      args[k].step = num_handles + 1;
+      args[k].w = w;
+      args[k].depth = depth;
+
+      /* the calling thread uses the temporaries passed in */
+      args[k].t1 = (k == num_handles) ? t1 : t + k;
+      args[k].t2 = (k == num_handles) ? t2 : t + num_handles + k;
+      args[k].tt = (k == num_handles) ? tt : t + 3*num_handles + k;
    }
-}
 
+   for (k = 0; k < num_handles; k++)
+      thread_pool_wake(global_thread_pool, handles[k], _fft_inner_worker, args + k);
+   _fft_inner_worker(args + num_handles);
+   for (k = 0; k < num_handles; k++)
+      thread_pool_wait(global_thread_pool, handles[k]);
+
+   if (num_handles > 0)
+      _fft_thread_temps_clear(ii, jj, 4*n, t, num_handles, limbs);
+
+   flint_give_back_threads(handles, num_handles);
+   flint_free(args);
+}
@@ -13,6 +13,7 @@
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fft.h"
+#include "thread_pool.h"
 
 void ifft_butterfly_twiddle(mp_limb_t * u, mp_limb_t * v, 
    mp_limb_t * s, mp_limb_t * t, mp_size_t limbs, flint_bitcnt_t b1, flint_bitcnt_t b2)
@@ -245,30 +246,28 @@ void ifft_mfa_truncate_sqrt2(mp_limb_t ** ii, mp_size_t n, flint_bitcnt_t w,
    }
 }
 
-void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, flint_bitcnt_t w, 
-   mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
+typedef struct
 {
+   mp_limb_t ** ii;
+   mp_size_t n, n1, n2, trunc, trunc2, limbs, start, step;
+   flint_bitcnt_t w, depth, depth2;
+   mp_limb_t ** t1, ** t2, ** temp;
+} ifft_outer_arg_t;
+
+/* first half mfa IFFT : n2 rows, n1 cols */
+static void _ifft_outer1_worker(void * arg_ptr)
+{
+   ifft_outer_arg_t * arg = (ifft_outer_arg_t *) arg_ptr;
+   mp_limb_t ** ii = arg->ii;
+   mp_size_t n1 = arg->n1, n2 = arg->n2;
+   flint_bitcnt_t w = arg->w, depth = arg->depth;
+   mp_limb_t ** t1 = arg->t1, ** t2 = arg->t2;
    mp_size_t i, j;
-   mp_size_t n2 = (2*n)/n1;
-   mp_size_t trunc2 = (trunc - 2*n)/n1;
-   flint_bitcnt_t depth = 0;
-   flint_bitcnt_t depth2 = 0;
-   flint_bitcnt_t limbs = (w*n)/FLINT_BITS;
-   int k = 0;
-  
-   while ((UWORD(1)<<depth) < n2) depth++;
-   while ((UWORD(1)<<depth2) < n1) depth2++;
 
-   /* first half mfa IFFT : n2 rows, n1 cols */
-   
    /* column IFFTs */
-#pragma omp parallel for private(i, j, k)
-   for (i = 0; i < n1; i++)
-   {   
-#if HAVE_OPENMP
-      k = omp_get_thread_num();
-#endif
 
+   for (i = arg->start; i < n1; i += arg->step)
+   {   
       for (j = 0; j < n2; j++)
       {
          mp_size_t s = n_revbin(j, depth);
@@ -279,21 +278,25 @@ void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, flint_bitcnt_t
          IFFT of length n2 on column i, applying z^{r*i} for rows going up in steps 
          of 1 starting at row 0, where z => w bits
       */
-      ifft_radix2_twiddle(ii + i, n1, n2/2, w*n1, t1 + k, t2 + k, w, 0, i, 1);
+      ifft_radix2_twiddle(ii + i, n1, n2/2, w*n1, t1, t2, w, 0, i, 1);
    }
-   
-   /* second half IFFT : n2 rows, n1 cols */
-   ii += 2*n;
+}
+
+/* second half IFFT : n2 rows, n1 cols */
+static void _ifft_outer2_worker(void * arg_ptr)
+{
+   ifft_outer_arg_t * arg = (ifft_outer_arg_t *) arg_ptr;
+   mp_size_t n = arg->n, n1 = arg->n1, n2 = arg->n2;
+   mp_size_t trunc = arg->trunc, trunc2 = arg->trunc2, limbs = arg->limbs;
+   flint_bitcnt_t w = arg->w, depth = arg->depth, depth2 = arg->depth2;
+   mp_limb_t ** ii = arg->ii + 2*n;
+   mp_limb_t ** t1 = arg->t1, ** t2 = arg->t2, ** temp = arg->temp;
+   mp_size_t i, j;
 
    /* column IFFTs with relevant sqrt2 layer butterflies combined */
 
-#pragma omp parallel for private(i, j, k)
-   for (i = 0; i < n1; i++)
+   for (i = arg->start; i < n1; i += arg->step)
    {   
-#if HAVE_OPENMP
-      k = omp_get_thread_num();
-#endif
-
       for (j = 0; j < trunc2; j++)
       {
          mp_size_t s = n_revbin(j, depth);
@@ -306,7 +309,7 @@ void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, flint_bitcnt_t
          if (w & 1)
          {
             if (i & 1)
-               fft_adjust_sqrt2(ii[i + j*n1], ii[u - 2*n], u, limbs, w, temp[k]); 
+               fft_adjust_sqrt2(ii[i + j*n1], ii[u - 2*n], u, limbs, w, *temp); 
             else
                fft_adjust(ii[i + j*n1], ii[u - 2*n], u/2, limbs, w); 
          } else
@@ -317,7 +320,7 @@ void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, flint_bitcnt_t
          IFFT of length n2 on column i, applying z^{r*i} for rows going up in steps 
          of 1 starting at row 0, where z => w bits
       */
-      ifft_truncate1_twiddle(ii + i, n1, n2/2, w*n1, t1 + k, t2 + k, w, 0, i, 1, trunc2);
+      ifft_truncate1_twiddle(ii + i, n1, n2/2, w*n1, t1, t2, w, 0, i, 1, trunc2);
       
       /* relevant components of final sqrt2 layer of IFFT */
       if (w & 1)
@@ -325,21 +328,21 @@ void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, flint_bitcnt_t
          for (j = i; j < trunc - 2*n; j+=n1) 
          {   
             if (j & 1)
-               ifft_butterfly_sqrt2(t1[k], t2[k], ii[j - 2*n], ii[j], j, limbs, w, temp[k]); 
+               ifft_butterfly_sqrt2(*t1, *t2, ii[j - 2*n], ii[j], j, limbs, w, *temp); 
             else
-               ifft_butterfly(t1[k], t2[k], ii[j - 2*n], ii[j], j/2, limbs, w);
+               ifft_butterfly(*t1, *t2, ii[j - 2*n], ii[j], j/2, limbs, w);
 
-            SWAP_PTRS(ii[j-2*n], t1[k]);
-            SWAP_PTRS(ii[j],     t2[k]);
+            SWAP_PTRS(ii[j-2*n], *t1);
+            SWAP_PTRS(ii[j],     *t2);
          }
       } else
       {
          for (j = i; j < trunc - 2*n; j+=n1) 
          {   
-            ifft_butterfly(t1[k], t2[k], ii[j - 2*n], ii[j], j, limbs, w/2);
+            ifft_butterfly(*t1, *t2, ii[j - 2*n], ii[j], j, limbs, w/2);
    
-            SWAP_PTRS(ii[j-2*n], t1[k]);
-            SWAP_PTRS(ii[j],     t2[k]);
+            SWAP_PTRS(ii[j-2*n], *t1);
+            SWAP_PTRS(ii[j],     *t2);
          }
       }
 
@@ -361,3 +364,66 @@ void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, flint_bitcnt_t
       }
    }
 }
+
+void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, flint_bitcnt_t w, 
+   mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
+{
+   mp_size_t n2 = (2*n)/n1;
+   mp_size_t limbs = (w*n)/FLINT_BITS;
+   flint_bitcnt_t depth = 0;
+   flint_bitcnt_t depth2 = 0;
+   thread_pool_handle * handles = NULL;
+   slong num_handles = 0, k;
+   ifft_outer_arg_t * args;
+   mp_limb_t ** t = NULL;
+
+   while ((UWORD(1)<<depth) < n2) depth++;
+   while ((UWORD(1)<<depth2) < n1) depth2++;
+
+   if (4*n*limbs >= FFT_THREADED_CUTOFF)
+      num_handles = flint_request_threads(&handles, flint_get_num_threads());
+
+   args = flint_malloc((num_handles + 1)*sizeof(ifft_outer_arg_t));
+
+   if (num_handles > 0)
+      t = _fft_thread_temps_init(num_handles, limbs);
+
+   for (k = 0; k <= num_handles; k++)
+   {
+      args[k].ii = ii;
+      args[k].n = n;
+      args[k].n1 = n1;
+      args[k].n2 = n2;
+      args[k].trunc = trunc;
+      args[k].trunc2 = (trunc - 2*n)/n1;
+      args[k].limbs = limbs;
+      args[k].start = k;
+      args[k].step = num_handles + 1;
+      args[k].w = w;
+      args[k].depth = depth;
+      args[k].depth2 = depth2;
+
+      /* the calling thread uses the temporaries passed in */
+      args[k].t1 = (k == num_handles) ? t1 : t + k;
+      args[k].t2 = (k == num_handles) ? t2 : t + num_handles + k;
+      args[k].temp = (k == num_handles) ? temp : t + 2*num_handles + k;
+   }
+
+   for (k = 0; k < num_handles; k++)
+      thread_pool_wake(global_thread_pool, handles[k], _ifft_outer1_worker, args + k);
+   _ifft_outer1_worker(args + num_handles);
+   for (k = 0; k < num_handles; k++)
+      thread_pool_wait(global_thread_pool, handles[k]);
+
+   for (k = 0; k < num_handles; k++)
+      thread_pool_wake(global_thread_pool, handles[k], _ifft_outer2_worker, args + k);
+   _ifft_outer2_worker(args + num_handles);
+   for (k = 0; k < num_handles; k++)
+      thread_pool_wait(global_thread_pool, handles[k]);
+
+   if (num_handles > 0)
+      _fft_thread_temps_clear(ii, ii, 4*n, t, num_handles, limbs);
+
+   flint_give_back_threads(handles, num_handles);
+   flint_free(args);
+}
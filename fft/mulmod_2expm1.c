@@ -0,0 +1,189 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gmp.h"
+#include "flint.h"
+#include "fft.h"
+#include "mpn_extras.h"
+
+/*
+   Reduces (t, tl) modulo 2^N - 1 in place, leaving a value in the range
+   [0, 2^N - 1). Requires tl limbs of scratch space in hi.
+*/
+static void
+_fft_fold_2expm1(mp_ptr t, mp_size_t tl, flint_bitcnt_t N, mp_ptr hi)
+{
+   mp_size_t q = N/FLINT_BITS, rl, hl, i;
+   flint_bitcnt_t s = N % FLINT_BITS;
+
+   rl = q + (s != 0);
+
+   while (1)
+   {
+      hl = tl - q;
+
+      if (s)
+         mpn_rshift(hi, t + q, hl, s);
+      else
+         flint_mpn_copyi(hi, t + q, hl);
+
+      MPN_NORM(hi, hl);
+      if (hl == 0)
+         break;
+
+      if (s)
+      {
+         t[q] &= ((UWORD(1) << s) - 1);
+         flint_mpn_zero(t + q + 1, tl - q - 1);
+      } else
+         flint_mpn_zero(t + q, tl - q);
+
+      mpn_add(t, t, tl, hi, hl);
+   }
+
+   /* 2^N - 1 is zero */
+   for (i = 0; i < q; i++)
+      if (t[i] != ~UWORD(0))
+         return;
+
+   if (s == 0 || t[q] == ((UWORD(1) << s) - 1))
+      flint_mpn_zero(t, rl);
+}
+
+void fft_mulmod_2expm1(mp_ptr r, mp_srcptr i1, mp_size_t n1,
+                       mp_srcptr i2, mp_size_t n2, flint_bitcnt_t bits,
+                                       flint_bitcnt_t depth, flint_bitcnt_t w)
+{
+   mp_size_t n = (UWORD(1)<<depth);
+   flint_bitcnt_t N = 4*n*bits;
+
+   mp_size_t r_limbs = (N - 1)/FLINT_BITS + 1;
+   mp_size_t limbs = (n*w)/FLINT_BITS;
+   mp_size_t size = limbs + 1;
+   mp_size_t extra = (FLINT_BITS - 1)/bits + 2;
+   mp_size_t i, j, tl;
+
+   mp_limb_t ** ii, ** jj, * t1, * t2, * s1, * tt, * ptr, * t;
+   mp_limb_t c;
+
+   FLINT_ASSERT(2*bits + depth + 2 <= n*w);
+
+   MPN_NORM(i1, n1);
+   MPN_NORM(i2, n2);
+
+   if (n1 == 0 || n2 == 0)
+   {
+      flint_mpn_zero(r, r_limbs);
+      return;
+   }
+
+   ii = flint_malloc(((4*n + extra)*(size + 1) + 5*size)*sizeof(mp_limb_t));
+   for (i = 0, ptr = (mp_limb_t *) ii + 4*n + extra; i < 4*n + extra; i++, ptr += size)
+   {
+      ii[i] = ptr;
+   }
+   t1 = ptr;
+   t2 = t1 + size;
+   s1 = t2 + size;
+   tt = s1 + size;
+
+   if (i1 != i2)
+   {
+      jj = flint_malloc((4*n + extra)*(size + 1)*sizeof(mp_limb_t));
+      for (i = 0, ptr = (mp_limb_t *) jj + 4*n + extra; i < 4*n + extra; i++, ptr += size)
+      {
+         jj[i] = ptr;
+      }
+   } else
+      jj = ii;
+
+   /*
+      The inputs are less than 2^N, so any coefficients split off beyond
+      the 4n-th are zero. No truncation is possible as the convolution
+      must be cyclic of length 4n.
+   */
+   j = fft_split_bits(ii, i1, n1, bits, limbs);
+   FLINT_ASSERT(j <= 4*n + extra);
+   for ( ; j < 4*n; j++)
+      flint_mpn_zero(ii[j], limbs + 1);
+
+   fft_truncate_sqrt2(ii, n, w, &t1, &t2, &s1, 4*n);
+
+   if (i1 != i2)
+   {
+      j = fft_split_bits(jj, i2, n2, bits, limbs);
+      FLINT_ASSERT(j <= 4*n + extra);
+      for ( ; j < 4*n; j++)
+         flint_mpn_zero(jj[j], limbs + 1);
+
+      fft_truncate_sqrt2(jj, n, w, &t1, &t2, &s1, 4*n);
+   }
+
+   for (j = 0; j < 4*n; j++)
+   {
+      mpn_normmod_2expp1(ii[j], limbs);
+      if (i1 != i2) mpn_normmod_2expp1(jj[j], limbs);
+      c = 2*ii[j][limbs] + jj[j][limbs];
+      ii[j][limbs] = flint_mpn_mulmod_2expp1_basecase(ii[j], ii[j], jj[j], c, n*w, tt);
+   }
+
+   ifft_truncate_sqrt2(ii, n, w, &t1, &t2, &s1, 4*n);
+   for (j = 0; j < 4*n; j++)
+   {
+      mpn_div_2expmod_2expp1(ii[j], ii[j], limbs, depth + 2);
+      mpn_normmod_2expp1(ii[j], limbs);
+   }
+
+   /* the coefficients are now the cyclic convolution, wrap the carries */
+   tl = r_limbs + limbs + 2;
+   t = flint_malloc(2*tl*sizeof(mp_limb_t));
+   flint_mpn_zero(t, tl);
+   fft_combine_bits(t, ii, 4*n, bits, limbs, tl);
+   _fft_fold_2expm1(t, tl, N, t + tl);
+   flint_mpn_copyi(r, t, r_limbs);
+
+   flint_free(t);
+   flint_free(ii);
+   if (i1 != i2)
+      flint_free(jj);
+}
+
+mp_size_t fft_mulmod_2expm1_params(flint_bitcnt_t * depth_out,
+              flint_bitcnt_t * w_out, mp_size_t len, flint_bitcnt_t bits)
+{
+   mp_size_t depth = 6, w, n = WORD(64), m;
+
+   /*
+      The transform length cannot be truncated, so rather than packing the
+      coefficients as tightly as possible we increase the depth until the
+      coefficients are at most 18n bits, which is roughly optimal.
+   */
+   while (1)
+   {
+      m = (len + 4*n - 1)/(4*n);
+      w = (2*m*bits + depth + 2 + n - 1)/n;
+
+      if (w <= 18)
+         break;
+
+      depth++;
+      n *= 2;
+   }
+
+   /* allow the pointwise products to use fft_mulmod_2expp1 */
+   while (fft_adjust_limbs((n*w)/FLINT_BITS) != (n*w)/FLINT_BITS)
+      w++;
+
+   *depth_out = depth;
+   *w_out = w;
+
+   return m;
+}
@@ -0,0 +1,132 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fft.h"
+
+int
+main(void)
+{
+    slong depth, w, iters;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("convolution_precache....");
+    fflush(stdout);
+
+    _flint_rand_init_gmp(state);
+
+    for (iters = 0; iters < 3; iters++)
+    {
+        for (depth = 6; depth <= 11; depth++)
+        {
+            for (w = 1; w <= 3; w++)
+            {
+                slong n = (WORD(1)<<depth);
+                slong limbs, size, ww = w;
+                slong len1, len2, trunc, i, j, k;
+                mp_limb_t ** ii, ** jj, ** kk, ** ll, ** mm, * ptr;
+                mp_limb_t * t1, * t2, * s1, * tt;
+
+                /* large coefficients, where the pointwise products use FFTs */
+                if (w == 3)
+                {
+                    if (depth > 7)
+                        continue;
+                    ww = (512*FLINT_BITS)/n;
+                    while (fft_adjust_limbs((n*ww)/FLINT_BITS) != (n*ww)/FLINT_BITS)
+                        ww++;
+                }
+
+                limbs = (n*ww)/FLINT_BITS;
+                size = limbs + 1;
+
+                /* full cyclic convolution or a truncated linear one */
+                if (n_randint(state, 2))
+                {
+                    trunc = 4*n;
+                    len1 = n_randint(state, 4*n) + 1;
+                    len2 = n_randint(state, 4*n) + 1;
+                } else
+                {
+                    trunc = 2*n + 1 + n_randint(state, 2*n - 1);
+                    len1 = n_randint(state, trunc) + 1;
+                    len2 = trunc - len1 + 1;
+                }
+
+                ii = flint_malloc((5*(4*n + 4*n*size) + 5*size)*sizeof(mp_limb_t));
+                for (k = 0, ptr = (mp_limb_t *) ii + 20*n; k < 20*n; k++, ptr += size)
+                    ii[k] = ptr;
+                jj = ii + 4*n;
+                kk = jj + 4*n;
+                ll = kk + 4*n;
+                mm = ll + 4*n;
+                t1 = ptr;
+                t2 = t1 + size;
+                s1 = t2 + size;
+                tt = s1 + size;
+
+                for (j = 0; j < 4*n; j++)
+                {
+                    flint_mpn_zero(jj[j], size);
+                    if (j < len2)
+                        mpn_random2(jj[j], limbs);
+                    flint_mpn_copyi(mm[j], jj[j], size);
+                }
+
+                fft_precache(jj, depth, limbs, trunc, &t1, &t2, &s1);
+
+                /* use the precached transform twice */
+                for (i = 0; i < 2; i++)
+                {
+                    for (j = 0; j < 4*n; j++)
+                    {
+                        flint_mpn_zero(ii[j], size);
+                        if (j < len1)
+                            mpn_random2(ii[j], limbs);
+                        flint_mpn_copyi(kk[j], ii[j], size);
+                        flint_mpn_copyi(ll[j], mm[j], size);
+                    }
+
+                    fft_convolution(kk, ll, depth, limbs, trunc,
+                                                       &t1, &t2, &s1, &tt);
+                    fft_convolution_precache(ii, jj, depth, limbs, trunc,
+                                                       &t1, &t2, &s1, &tt);
+
+                    for (j = 0; j < trunc; j++)
+                    {
+                        mpn_normmod_2expp1(ii[j], limbs);
+                        mpn_normmod_2expp1(kk[j], limbs);
+
+                        if (mpn_cmp(ii[j], kk[j], size) != 0)
+                        {
+                            flint_printf("FAIL:\n");
+                            flint_printf("depth = %wd, w = %wd, trunc = %wd, "
+                                "i = %wd, j = %wd\n", depth, w, trunc, i, j);
+                            abort();
+                        }
+                    }
+                }
+
+                flint_free(ii);
+            }
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -40,6 +40,8 @@ main(void)
             mp_size_t int_limbs = (bits - 1)/FLINT_BITS + 1;
             mp_size_t j;
             mp_limb_t * i1, *i2, *r1, *r2;
+
+            flint_set_num_threads(n_randint(state, 4) + 1);
         
             i1 = flint_malloc(6*int_limbs*sizeof(mp_limb_t));
             i2 = i1 + int_limbs;
@@ -77,6 +79,8 @@ main(void)
             mp_size_t int_limbs = (bits - 1)/FLINT_BITS + 1;
             mp_size_t j;
             mp_limb_t * i1, *r1, *r2;
+
+            flint_set_num_threads(n_randint(state, 4) + 1);
         
             i1 = flint_malloc(5*int_limbs*sizeof(mp_limb_t));
             r1 = i1 + int_limbs;
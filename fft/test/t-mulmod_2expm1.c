@@ -0,0 +1,128 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fft.h"
+
+int
+main(void)
+{
+    flint_bitcnt_t depth, w, bits, N;
+    int iters;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mulmod_2expm1....");
+    fflush(stdout);
+
+    _flint_rand_init_gmp(state);
+
+    for (iters = 0; iters < 5; iters++)
+    {
+        for (depth = 6; depth <= 12; depth++)
+        {
+            for (w = 1; w <= 2; w++)
+            {
+                mp_size_t n = (UWORD(1)<<depth);
+                mp_size_t r_limbs;
+                size_t cnt;
+                mp_limb_t * i1, * i2, * r1;
+                mpz_t a, b, p, m;
+                int sqr = (n_randint(state, 4) == 0);
+
+                bits = (n*w - depth - 2)/2;
+                bits = n_randint(state, bits) + 1;
+                N = 4*n*bits;
+                r_limbs = (N - 1)/FLINT_BITS + 1;
+
+                mpz_init(a);
+                mpz_init(b);
+                mpz_init(p);
+                mpz_init(m);
+
+                /* m = 2^N - 1 */
+                mpz_set_ui(m, 1);
+                mpz_mul_2exp(m, m, N);
+                mpz_sub_ui(m, m, 1);
+
+                /* a and b are less than 2^N, possibly equal to 2^N - 1 */
+                if (n_randint(state, 8) == 0)
+                    mpz_set(a, m);
+                else
+                    mpz_urandomb(a, state->gmp_state, n_randint(state, N) + 1);
+
+                if (sqr)
+                    mpz_set(b, a);
+                else
+                    mpz_urandomb(b, state->gmp_state, n_randint(state, N) + 1);
+
+                i1 = flint_calloc(3*r_limbs, sizeof(mp_limb_t));
+                i2 = i1 + r_limbs;
+                r1 = i2 + r_limbs;
+
+                mpz_export(i1, &cnt, -1, sizeof(mp_limb_t), 0, 0, a);
+                mpz_export(i2, &cnt, -1, sizeof(mp_limb_t), 0, 0, b);
+
+                if (sqr)
+                    fft_mulmod_2expm1(r1, i1, r_limbs, i1, r_limbs, bits, depth, w);
+                else
+                    fft_mulmod_2expm1(r1, i1, r_limbs, i2, r_limbs, bits, depth, w);
+
+                mpz_mul(p, a, b);
+                mpz_mod(p, p, m);
+                mpz_import(a, r_limbs, -1, sizeof(mp_limb_t), 0, 0, r1);
+
+                if (mpz_cmp(a, p) != 0)
+                {
+                    flint_printf("FAIL:\n");
+                    flint_printf("depth = %wu, w = %wu, bits = %wu\n", depth, w, bits);
+                    abort();
+                }
+
+                flint_free(i1);
+                mpz_clear(a);
+                mpz_clear(b);
+                mpz_clear(p);
+                mpz_clear(m);
+            }
+        }
+    }
+
+    /* check the parameters */
+    for (iters = 0; iters < 1000; iters++)
+    {
+        mp_size_t len, m, n;
+
+        len = n_randint(state, 100000) + 1;
+        bits = n_randint(state, 200) + 1;
+
+        m = fft_mulmod_2expm1_params(&depth, &w, len, bits);
+        n = (UWORD(1)<<depth);
+
+        if (4*n*m < len || 2*m*bits + depth + 2 > n*w || (n*w) % FLINT_BITS != 0
+            || fft_adjust_limbs((n*w)/FLINT_BITS) != (n*w)/FLINT_BITS)
+        {
+            flint_printf("FAIL (params):\n");
+            flint_printf("len = %wd, bits = %wu, depth = %wu, w = %wu, m = %wd\n",
+                         len, bits, depth, w, m);
+            abort();
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
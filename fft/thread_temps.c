@@ -0,0 +1,88 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gmp.h"
+#include "flint.h"
+#include "fft.h"
+
+mp_limb_t ** _fft_thread_temps_init(slong num, mp_size_t limbs)
+{
+   mp_size_t size = limbs + 1;
+   mp_limb_t ** t, * ptr;
+   slong k;
+
+   t = flint_malloc(4*num*sizeof(mp_limb_t *) + 5*num*size*sizeof(mp_limb_t));
+   ptr = (mp_limb_t *) (t + 4*num);
+
+   for (k = 0; k < num; k++, ptr += 5*size)
+   {
+      t[k] = ptr;
+      t[num + k] = ptr + size;
+      t[2*num + k] = ptr + 2*size;
+      t[3*num + k] = ptr + 3*size;
+   }
+
+   return t;
+}
+
+static void
+_fft_swap_back(mp_limb_t ** ii, mp_size_t len, mp_limb_t * orig,
+                                       mp_limb_t * held, mp_size_t size)
+{
+   mp_size_t i;
+
+   for (i = 0; i < len; i++)
+   {
+      if (ii[i] == orig)
+      {
+         flint_mpn_copyi(held, orig, size);
+         ii[i] = held;
+         return;
+      }
+   }
+}
+
+void _fft_thread_temps_clear(mp_limb_t ** ii, mp_limb_t ** jj, mp_size_t len,
+                                mp_limb_t ** t, slong num, mp_size_t limbs)
+{
+   mp_size_t size = limbs + 1;
+   mp_limb_t * o1, * o2, * h1, * h2;
+   slong k;
+
+   for (k = 0; k < num; k++)
+   {
+      /* the buffers allocated for t1 and t2 precede temp */
+      o1 = t[2*num + k] - 2*size;
+      o2 = t[2*num + k] - size;
+      h1 = t[k];
+      h2 = t[num + k];
+
+      /* h1 and h2 are o1 and o2 in some order, or came from ii or jj */
+      if (h1 == o2 || h2 == o1)
+         MP_PTR_SWAP(h1, h2);
+
+      if (h1 != o1)
+      {
+         _fft_swap_back(ii, len, o1, h1, size);
+         if (jj != ii)
+            _fft_swap_back(jj, len, o1, h1, size);
+      }
+
+      if (h2 != o2)
+      {
+         _fft_swap_back(ii, len, o2, h2, size);
+         if (jj != ii)
+            _fft_swap_back(jj, len, o2, h2, size);
+      }
+   }
+
+   flint_free(t);
+}
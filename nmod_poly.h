@@ -46,6 +46,11 @@
 #define NMOD_POLY_GCD_CUTOFF  340       /* GCD:  Euclidean -> HGCD          */
 #define NMOD_POLY_SMALL_GCD_CUTOFF 200  /* GCD (small n): Euclidean -> HGCD */
 
+#define NMOD_POLY_MULMID_FFT_CUTOFF 8000 /* mulmid: full product -> cyclic FFT */
+#define NMOD_POLY_REM_PRECOMP_CUTOFF 2000 /* rem_precomp: Newton -> cached FFT, limbs */
+#define NMOD_POLY_MUL_THREADED_CUTOFF 50000 /* mul: KS4 -> threaded KS, limbs */
+#define NMOD_POLY_NEWTON_FFT_CUTOFF 6000 /* series Newton: mullow -> cached FFT, limbs */
+
 NMOD_POLY_INLINE
 slong NMOD_DIVREM_BC_ITCH(slong lenA, slong lenB, nmod_t mod)
 {
@@ -508,6 +513,12 @@ FLINT_DLL void _nmod_poly_bit_pack(mp_ptr res, mp_srcptr poly,
 FLINT_DLL void _nmod_poly_bit_unpack(mp_ptr res, slong len, 
                                   mp_srcptr mpn, flint_bitcnt_t bits, nmod_t mod);
 
+FLINT_DLL void _nmod_poly_bit_pack_threaded(mp_ptr res, mp_srcptr poly,
+                                                  slong len, flint_bitcnt_t bits);
+
+FLINT_DLL void _nmod_poly_bit_unpack_threaded(mp_ptr res, slong len,
+                                  mp_srcptr mpn, flint_bitcnt_t bits, nmod_t mod);
+
 FLINT_DLL void nmod_poly_bit_pack(fmpz_t f, const nmod_poly_t poly,
                    flint_bitcnt_t bit_size);
 
@@ -533,6 +544,12 @@ FLINT_DLL void _nmod_poly_mulhigh_classical(mp_ptr res, mp_srcptr poly1, slong l
 FLINT_DLL void nmod_poly_mulhigh_classical(nmod_poly_t res, 
                   const nmod_poly_t poly1, const nmod_poly_t poly2, slong start);
 
+FLINT_DLL void _nmod_poly_mulmid_classical(mp_ptr res, mp_srcptr poly1,
+                 slong len1, mp_srcptr poly2, slong len2, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mulmid_classical(nmod_poly_t res,
+                             const nmod_poly_t poly1, const nmod_poly_t poly2);
+
 FLINT_DLL void _nmod_poly_mul_KS(mp_ptr out, mp_srcptr in1, slong len1, 
                         mp_srcptr in2, slong len2, flint_bitcnt_t bits, nmod_t mod);
 
@@ -557,6 +574,12 @@ FLINT_DLL void _nmod_poly_mullow_KS(mp_ptr out, mp_srcptr in1, slong len1,
 FLINT_DLL void nmod_poly_mullow_KS(nmod_poly_t res, const nmod_poly_t poly1, 
                              const nmod_poly_t poly2, flint_bitcnt_t bits, slong n);
 
+FLINT_DLL void _nmod_poly_mulmid_KS(mp_ptr out, mp_srcptr in1, slong len1,
+               mp_srcptr in2, slong len2, flint_bitcnt_t bits, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mulmid_KS(nmod_poly_t res, const nmod_poly_t poly1,
+                             const nmod_poly_t poly2, flint_bitcnt_t bits);
+
 FLINT_DLL void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, slong len1, 
                                        mp_srcptr poly2, slong len2, nmod_t mod);
 
@@ -575,6 +598,12 @@ FLINT_DLL void _nmod_poly_mulhigh(mp_ptr res, mp_srcptr poly1, slong len1,
 FLINT_DLL void nmod_poly_mulhigh(nmod_poly_t res, const nmod_poly_t poly1, 
                                               const nmod_poly_t poly2, slong n);
 
+FLINT_DLL void _nmod_poly_mulmid(mp_ptr res, mp_srcptr poly1, slong len1,
+                                       mp_srcptr poly2, slong len2, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mulmid(nmod_poly_t res, const nmod_poly_t poly1,
+                                                      const nmod_poly_t poly2);
+
 FLINT_DLL void _nmod_poly_mulmod(mp_ptr res, mp_srcptr poly1, slong len1, 
                              mp_srcptr poly2, slong len2, mp_srcptr f,
                             slong lenf, nmod_t mod);
@@ -590,6 +619,66 @@ FLINT_DLL void nmod_poly_mulmod_preinv(nmod_poly_t res, const nmod_poly_t poly1,
                         const nmod_poly_t poly2, const nmod_poly_t f,
                         const nmod_poly_t finv);
 
+typedef struct
+{
+    mp_limb_t ** ii;         /* transformed Fermat ring coefficients */
+    slong len;               /* products are taken modulo x^len - 1 */
+    slong m;                 /* coefficients per FFT coefficient */
+    flint_bitcnt_t bits;     /* bits per packed coefficient */
+    flint_bitcnt_t depth, w;
+} nmod_poly_fft_image_struct;
+
+typedef nmod_poly_fft_image_struct nmod_poly_fft_image_t[1];
+
+FLINT_DLL void nmod_poly_fft_image_init(nmod_poly_fft_image_t F,
+                                                    slong len, nmod_t mod);
+
+FLINT_DLL void nmod_poly_fft_image_clear(nmod_poly_fft_image_t F);
+
+FLINT_DLL void _nmod_poly_fft_image_set(nmod_poly_fft_image_t F,
+                                  mp_srcptr poly, slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_poly_fft_image_mul(mp_ptr res, slong lo, slong hi,
+                              mp_srcptr poly, slong len,
+                              const nmod_poly_fft_image_t F, nmod_t mod);
+
+typedef struct
+{
+    mp_ptr f;                /* the modulus, length lenf */
+    mp_ptr finv;             /* inverse of the reverse of f */
+    slong lenf;
+    slong lenfinv;
+    nmod_t mod;
+    int fft;                 /* whether the transforms below are used */
+    nmod_poly_fft_image_t finv_fft;  /* image of finv, for the quotient */
+    nmod_poly_fft_image_t f_fft;     /* image of f mod x^L - 1 */
+} nmod_poly_rem_precomp_struct;
+
+typedef nmod_poly_rem_precomp_struct nmod_poly_rem_precomp_t[1];
+
+FLINT_DLL void _nmod_poly_rem_precomp_init(nmod_poly_rem_precomp_t P,
+                     mp_srcptr f, slong lenf, mp_srcptr finv, slong lenfinv,
+                                                                 nmod_t mod);
+
+FLINT_DLL void nmod_poly_rem_precomp_init(nmod_poly_rem_precomp_t P,
+                              const nmod_poly_t f, const nmod_poly_t finv);
+
+FLINT_DLL void nmod_poly_rem_precomp_clear(nmod_poly_rem_precomp_t P);
+
+FLINT_DLL void _nmod_poly_rem_precomp(mp_ptr R, mp_srcptr A, slong lenA,
+                                        const nmod_poly_rem_precomp_t P);
+
+FLINT_DLL void nmod_poly_rem_precomp(nmod_poly_t R, const nmod_poly_t A,
+                                        const nmod_poly_rem_precomp_t P);
+
+FLINT_DLL void _nmod_poly_mulmod_precomp(mp_ptr res, mp_srcptr poly1,
+                          slong len1, mp_srcptr poly2, slong len2,
+                                        const nmod_poly_rem_precomp_t P);
+
+FLINT_DLL void nmod_poly_mulmod_precomp(nmod_poly_t res,
+                      const nmod_poly_t poly1, const nmod_poly_t poly2,
+                                        const nmod_poly_rem_precomp_t P);
+
 FLINT_DLL int _nmod_poly_invmod(mp_limb_t *A, 
                       const mp_limb_t *B, slong lenB, 
                       const mp_limb_t *P, slong lenP, const nmod_t mod);
@@ -871,6 +960,49 @@ FLINT_DLL void _nmod_poly_tree_free(mp_ptr * tree, slong len);
 FLINT_DLL void _nmod_poly_tree_build(mp_ptr * tree, mp_srcptr roots,
     slong len, nmod_t mod);
 
+typedef struct
+{
+    mp_ptr * tree;   /* subproduct tree on the points */
+    mp_ptr root;     /* product M of all (x - x_i), length len + 1 */
+    mp_ptr rootinv;  /* inverse of the reverse of M to precision len */
+    mp_ptr weights;  /* interpolation weights, NULL if not invertible */
+    slong length;    /* number of points */
+    nmod_t mod;
+} nmod_poly_tree_struct;
+
+typedef nmod_poly_tree_struct nmod_poly_tree_t[1];
+
+FLINT_DLL void nmod_poly_tree_init(nmod_poly_tree_t T,
+                                 mp_srcptr xs, slong len, mp_limb_t n);
+
+FLINT_DLL void nmod_poly_tree_clear(nmod_poly_tree_t T);
+
+NMOD_POLY_INLINE
+slong nmod_poly_tree_length(const nmod_poly_tree_t T)
+{
+    return T->length;
+}
+
+FLINT_DLL void _nmod_poly_evaluate_nmod_vec_tree_vec(mp_ptr * ys,
+                      const mp_srcptr * polys, const slong * lens, slong num,
+                                                   const nmod_poly_tree_t T);
+
+FLINT_DLL void nmod_poly_evaluate_nmod_vec_tree(mp_ptr ys,
+                           const nmod_poly_t poly, const nmod_poly_tree_t T);
+
+FLINT_DLL void nmod_poly_evaluate_nmod_vec_tree_vec(mp_ptr * ys,
+       const nmod_poly_struct * polys, slong num, const nmod_poly_tree_t T);
+
+FLINT_DLL void _nmod_poly_interpolate_nmod_vec_tree_vec(mp_ptr * polys,
+                 const mp_srcptr * ys, slong num, const nmod_poly_tree_t T);
+
+FLINT_DLL void nmod_poly_interpolate_nmod_vec_tree(nmod_poly_t poly,
+                                 mp_srcptr ys, const nmod_poly_tree_t T);
+
+FLINT_DLL void nmod_poly_interpolate_nmod_vec_tree_vec(
+                  nmod_poly_struct * polys, const mp_srcptr * ys, slong num,
+                                                   const nmod_poly_tree_t T);
+
 /* Interpolation  ************************************************************/
 
 FLINT_DLL void _nmod_poly_interpolate_nmod_vec_newton(mp_ptr poly, mp_srcptr xs,
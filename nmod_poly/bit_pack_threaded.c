@@ -0,0 +1,71 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    mp_ptr res;
+    mp_srcptr poly;
+    slong len;
+    flint_bitcnt_t bits;
+} _bit_pack_arg_t;
+
+static void _bit_pack_worker(void * arg_ptr)
+{
+    _bit_pack_arg_t * arg = (_bit_pack_arg_t *) arg_ptr;
+
+    if (arg->len > 0)
+        _nmod_poly_bit_pack(arg->res, arg->poly, arg->len, arg->bits);
+}
+
+/*
+   Blocks of coefficients starting at multiples of FLINT_BITS/gcd(bits,
+   FLINT_BITS) start on a limb boundary, so they can be packed separately.
+*/
+void _nmod_poly_bit_pack_threaded(mp_ptr res, mp_srcptr poly,
+                                               slong len, flint_bitcnt_t bits)
+{
+    thread_pool_handle * handles;
+    slong num_handles, num_workers, i, start, chunk;
+    slong align = FLINT_BITS/n_gcd(bits, FLINT_BITS);
+    _bit_pack_arg_t * args;
+
+    num_handles = flint_request_threads(&handles, flint_get_num_threads());
+    num_workers = FLINT_MIN(num_handles, len/align);
+
+    chunk = ((len + num_workers)/(num_workers + 1) + align - 1)/align*align;
+
+    args = flint_malloc((num_workers + 1)*sizeof(_bit_pack_arg_t));
+
+    for (i = 0, start = 0; i <= num_workers; i++, start += chunk)
+    {
+        args[i].res = res + (start*bits)/FLINT_BITS;
+        args[i].poly = poly + start;
+        args[i].len = FLINT_MAX(FLINT_MIN(chunk, len - start), 0);
+        args[i].bits = bits;
+    }
+
+    for (i = 0; i < num_workers; i++)
+        thread_pool_wake(global_thread_pool, handles[i],
+                                                _bit_pack_worker, args + i);
+    _bit_pack_worker(args + num_workers);
+    for (i = 0; i < num_workers; i++)
+        thread_pool_wait(global_thread_pool, handles[i]);
+
+    flint_give_back_threads(handles, num_handles);
+    flint_free(args);
+}
@@ -0,0 +1,200 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+    Evaluation by the transposed (scaled) remainder tree. For a node P of
+    degree d we keep the first d coefficients of the expansion of
+    (f mod P) / P in 1/x, stored in reverse order. For the root these are
+    obtained from the reversed polynomial by multiplying by the inverse of
+    the reversed product of all nodes, and for a child they are a middle
+    product of the parent's coefficients with the sibling node. At a leaf
+    x - a the single coefficient is f(a).
+*/
+void
+_nmod_poly_evaluate_nmod_vec_tree_vec(mp_ptr * ys,
+                      const mp_srcptr * polys, const slong * lens, slong num,
+                                                    const nmod_poly_tree_t T)
+{
+    const slong len = T->length;
+    const nmod_t mod = T->mod;
+    slong i, k, h, pow, left, active, qlen;
+    mp_ptr * t, * u, a, b, Q, swap, pa;
+    slong * idx;
+
+    if (len == 0 || num == 0)
+        return;
+
+    idx = flint_malloc(sizeof(slong) * num);
+    active = 0;
+    qlen = 0;
+
+    /* degenerate cases are dealt with directly */
+    for (k = 0; k < num; k++)
+    {
+        slong plen = lens[k];
+
+        if (plen == 0)
+            _nmod_vec_zero(ys[k], len);
+        else if (plen == 1)
+            for (i = 0; i < len; i++)
+                ys[k][i] = polys[k][0];
+        else if (len == 1)
+            ys[k][0] = _nmod_poly_evaluate_nmod(polys[k], plen,
+                                        nmod_neg(T->tree[0][0], mod), mod);
+        else
+        {
+            idx[active++] = k;
+            qlen = FLINT_MAX(qlen, plen);
+        }
+    }
+
+    if (active == 0)
+    {
+        flint_free(idx);
+        return;
+    }
+
+    t = flint_malloc(sizeof(mp_ptr) * 2 * active);
+    u = t + active;
+    a = _nmod_vec_init(2 * len);
+    b = a + len;
+    Q = (qlen > len) ? _nmod_vec_init(qlen) : NULL;
+
+    /* coefficients at the root */
+    for (k = 0; k < active; k++)
+    {
+        mp_srcptr f = polys[idx[k]];
+        slong flen = lens[idx[k]];
+
+        t[k] = ys[idx[k]];
+        u[k] = _nmod_vec_init(len);
+
+        if (flen > len)
+        {
+            if (flen <= 2 * len)
+                _nmod_poly_divrem_newton_n_preinv(Q, b, f, flen,
+                                     T->root, len + 1, T->rootinv, len, mod);
+            else
+                _nmod_poly_rem(b, f, flen, T->root, len + 1, mod);
+
+            f = b;
+            flen = len;
+        }
+
+        _nmod_poly_reverse(a, f, flen, len);
+        _nmod_poly_mullow(u[k], a, len, T->rootinv, len, len, mod);
+        _nmod_poly_reverse(t[k], u[k], len, len);
+    }
+
+    /*
+        Go down the tree. Each node is applied to all polynomials before
+        moving on to the next, so that the node stays in cache.
+    */
+    for (h = FLINT_CLOG2(len) - 1; h >= 0; h--)
+    {
+        pow = WORD(1) << h;
+        left = len;
+        pa = T->tree[h];
+
+        for (i = 0; left >= 2 * pow; i += 2 * pow)
+        {
+            for (k = 0; k < active; k++)
+            {
+                _nmod_poly_mulmid(u[k] + i, t[k] + i, 2 * pow,
+                                            pa + pow + 1, pow + 1, mod);
+                _nmod_poly_mulmid(u[k] + i + pow, t[k] + i, 2 * pow,
+                                            pa, pow + 1, mod);
+            }
+
+            pa += 2 * pow + 2;
+            left -= 2 * pow;
+        }
+
+        if (left > pow)
+        {
+            for (k = 0; k < active; k++)
+            {
+                _nmod_poly_mulmid(u[k] + i, t[k] + i, left,
+                                            pa + pow + 1, left - pow + 1, mod);
+                _nmod_poly_mulmid(u[k] + i + pow, t[k] + i, left,
+                                            pa, pow + 1, mod);
+            }
+        }
+        else if (left > 0)
+        {
+            for (k = 0; k < active; k++)
+                _nmod_vec_set(u[k] + i, t[k] + i, left);
+        }
+
+        for (k = 0; k < active; k++)
+        {
+            swap = t[k];
+            t[k] = u[k];
+            u[k] = swap;
+        }
+    }
+
+    /* the values are now in t, which may be the scratch space */
+    for (k = 0; k < active; k++)
+    {
+        if (t[k] != ys[idx[k]])
+        {
+            _nmod_vec_set(ys[idx[k]], t[k], len);
+            _nmod_vec_clear(t[k]);
+        }
+        else
+            _nmod_vec_clear(u[k]);
+    }
+
+    if (Q != NULL)
+        _nmod_vec_clear(Q);
+    _nmod_vec_clear(a);
+    flint_free(t);
+    flint_free(idx);
+}
+
+void
+nmod_poly_evaluate_nmod_vec_tree(mp_ptr ys,
+                            const nmod_poly_t poly, const nmod_poly_tree_t T)
+{
+    mp_srcptr p = poly->coeffs;
+
+    _nmod_poly_evaluate_nmod_vec_tree_vec(&ys, &p,
+                                                    &poly->length, 1, T);
+}
+
+void
+nmod_poly_evaluate_nmod_vec_tree_vec(mp_ptr * ys,
+        const nmod_poly_struct * polys, slong num, const nmod_poly_tree_t T)
+{
+    mp_srcptr * p;
+    slong * lens, k;
+
+    p = flint_malloc(sizeof(mp_srcptr) * num);
+    lens = flint_malloc(sizeof(slong) * num);
+
+    for (k = 0; k < num; k++)
+    {
+        p[k] = polys[k].coeffs;
+        lens[k] = polys[k].length;
+    }
+
+    _nmod_poly_evaluate_nmod_vec_tree_vec(ys, p, lens, num, T);
+
+    flint_free(p);
+    flint_free(lens);
+}
@@ -28,6 +28,7 @@ _nmod_poly_exp_series_newton(mp_ptr f, mp_ptr g,
     slong a[FLINT_BITS];
     slong i, m, m2, l;
     mp_ptr T, U, hprime;
+    int fft;
 
     T = _nmod_vec_init(n);
     U = _nmod_vec_init(n);
@@ -51,29 +52,77 @@ _nmod_poly_exp_series_newton(mp_ptr f, mp_ptr g,
         n = a[i];          /* new length */
         m2 = (m + 1) / 2;
         l = m - 1;         /* shifted for derivative */
+        fft = (n*(2*FLINT_BIT_COUNT(mod.n - 1) + FLINT_BIT_COUNT(n))
+                                >= NMOD_POLY_NEWTON_FFT_CUTOFF*FLINT_BITS);
 
-        /* g := exp(-h) + O(x^m) */
-        _nmod_poly_mullow(T, f, m, g, m2, m, mod);
-        _nmod_poly_mullow(g + m2, g, m2, T + m2, m - m2, m - m2, mod);
-        _nmod_vec_neg(g + m2, g + m2, m - m2, mod);
-
-        /* U := h' + g (f' - f h') + O(x^(n-1))
-           Note: should replace h' by h' mod x^(m-1) */
-        _nmod_vec_zero(f + m, n - m);
-        _nmod_poly_mullow(T, f, n, hprime, n, n, mod);     /* should be mulmid */
-        _nmod_poly_derivative(U, f, n, mod); U[n - 1] = 0; /* should skip low terms */
-        _nmod_vec_sub(U + l, U + l, T + l, n - l, mod);
-        _nmod_poly_mullow(T + l, g, n - m, U + l, n - m, n - m, mod);
-        _nmod_vec_add(U + l, hprime + l, T + l, n - m, mod);
-
-        /* f := f + f * (h - int U) + O(x^n) = exp(h) + O(x^n) */
-        _nmod_poly_integral(U, U, n, mod);  /* should skip low terms */
-        _nmod_vec_sub(U + m, h + m, U + m, n - m, mod);
-        _nmod_poly_mullow(f + m, f, n - m, U + m, n - m, n - m, mod);
+        if (fft)
+        {
+            /*
+               The three products by f (with g, h' and U) use a single
+               transform of f modulo x^L - 1, L >= n; none of the
+               coefficients we need wraps around.
+            */
+            nmod_poly_fft_image_t F;
+
+            nmod_poly_fft_image_init(F, n, mod);
+            _nmod_poly_fft_image_set(F, f, m, mod);
+
+            /* g := exp(-h) + O(x^m) */
+            _nmod_poly_fft_image_mul(T + m2, m2, m, g, m2, F, mod);
+            _nmod_poly_mullow(g + m2, g, m2, T + m2, m - m2, m - m2, mod);
+            _nmod_vec_neg(g + m2, g + m2, m - m2, mod);
+
+            /* U := h' + g (f' - f h') + O(x^(n-1)), only from x^l on,
+               where f' vanishes */
+            _nmod_poly_fft_image_mul(U + l, l, n, hprime, n, F, mod);
+            _nmod_vec_neg(U + l, U + l, n - l, mod);
+            _nmod_poly_mullow(T + l, g, n - m, U + l, n - m, n - m, mod);
+            _nmod_vec_add(U + l, hprime + l, T + l, n - m, mod);
+
+            /* f := f + f * (h - int U) + O(x^n) = exp(h) + O(x^n) */
+            _nmod_vec_zero(U, l);
+            _nmod_poly_integral(U, U, n, mod);  /* should skip low terms */
+            _nmod_vec_sub(U + m, h + m, U + m, n - m, mod);
+            _nmod_poly_fft_image_mul(f + m, 0, n - m, U + m, n - m, F, mod);
+
+            nmod_poly_fft_image_clear(F);
+        }
+        else
+        {
+            /* g := exp(-h) + O(x^m) */
+            _nmod_poly_mullow(T, f, m, g, m2, m, mod);
+            _nmod_poly_mullow(g + m2, g, m2, T + m2, m - m2, m - m2, mod);
+            _nmod_vec_neg(g + m2, g + m2, m - m2, mod);
+
+            /* U := h' + g (f' - f h') + O(x^(n-1))
+               Note: should replace h' by h' mod x^(m-1) */
+            _nmod_vec_zero(f + m, n - m);
+            _nmod_poly_mullow(T, f, n, hprime, n, n, mod);     /* should be mulmid */
+            _nmod_poly_derivative(U, f, n, mod); U[n - 1] = 0; /* should skip low terms */
+            _nmod_vec_sub(U + l, U + l, T + l, n - l, mod);
+            _nmod_poly_mullow(T + l, g, n - m, U + l, n - m, n - m, mod);
+            _nmod_vec_add(U + l, hprime + l, T + l, n - m, mod);
+
+            /* f := f + f * (h - int U) + O(x^n) = exp(h) + O(x^n) */
+            _nmod_poly_integral(U, U, n, mod);  /* should skip low terms */
+            _nmod_vec_sub(U + m, h + m, U + m, n - m, mod);
+            _nmod_poly_mullow(f + m, f, n - m, U + m, n - m, n - m, mod);
+        }
 
         /* g := exp(-h) + O(x^n) */
         /* not needed if we only want exp(x) */
-        if (i == 0 && inverse)
+        if (i == 0 && inverse && fft)
+        {
+            nmod_poly_fft_image_t G;
+
+            nmod_poly_fft_image_init(G, n, mod);
+            _nmod_poly_fft_image_set(G, g, m, mod);
+            _nmod_poly_fft_image_mul(T + m, m, n, f, n, G, mod);
+            _nmod_poly_fft_image_mul(g + m, 0, n - m, T + m, n - m, G, mod);
+            _nmod_vec_neg(g + m, g + m, n - m, mod);
+            nmod_poly_fft_image_clear(G);
+        }
+        else if (i == 0 && inverse)
         {
             _nmod_poly_mullow(T, f, n, g, m, n, mod);
             _nmod_poly_mullow(g + m, g, m, T + m, n - m, n - m, mod);
@@ -0,0 +1,137 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "fft.h"
+
+/*
+   The images are cyclic convolutions of length 4n over Z/(2^(nw) + 1),
+   each FFT coefficient holding m Kronecker packed coefficients of bits
+   bits, i.e. products modulo x^(4nm) - 1.
+*/
+
+static mp_limb_t **
+_fft_image_alloc(const nmod_poly_fft_image_t F)
+{
+    slong n = WORD(1) << F->depth;
+    slong len = 4*n + (FLINT_BITS - 1)/(F->m*F->bits) + 2;
+    slong size = (n*F->w)/FLINT_BITS + 1, i;
+    mp_limb_t ** ii, * ptr;
+
+    ii = flint_malloc((len*(size + 1) + 5*size)*sizeof(mp_limb_t));
+    for (i = 0, ptr = (mp_limb_t *) ii + len; i < len; i++, ptr += size)
+        ii[i] = ptr;
+
+    return ii;
+}
+
+/*
+   Splits (poly, len) reduced modulo x^L - 1 into ii and transforms it,
+   fused with the pointwise product by jj and the inverse transform if
+   jj is not NULL.
+*/
+static void
+_fft_image_transform(mp_limb_t ** ii, mp_limb_t ** jj, mp_srcptr poly,
+                    slong len, const nmod_poly_fft_image_t F, nmod_t mod)
+{
+    slong n = WORD(1) << F->depth;
+    slong limbs = (n*F->w)/FLINT_BITS;
+    slong size = limbs + 1;
+    slong len2 = 4*n + (FLINT_BITS - 1)/(F->m*F->bits) + 2;
+    slong plimbs, i, j;
+    mp_limb_t * t1, * t2, * s1, * tt;
+    mp_ptr t;
+
+    if (len > F->len)
+    {
+        t = _nmod_vec_init(F->len);
+        _nmod_vec_set(t, poly, F->len);
+        for (i = F->len; i < len; i++)
+            t[i % F->len] = nmod_add(t[i % F->len], poly[i], mod);
+        _fft_image_transform(ii, jj, t, F->len, F, mod);
+        _nmod_vec_clear(t);
+        return;
+    }
+
+    plimbs = (len*F->bits - 1)/FLINT_BITS + 1;
+    t = flint_calloc(plimbs, sizeof(mp_limb_t));
+    _nmod_poly_bit_pack(t, poly, len, F->bits);
+    j = fft_split_bits(ii, t, plimbs, F->m*F->bits, limbs);
+    flint_free(t);
+
+    for ( ; j < 4*n; j++)
+        flint_mpn_zero(ii[j], size);
+
+    t1 = (mp_ptr) ii + len2 + len2*size;
+    t2 = t1 + size;
+    s1 = t2 + size;
+    tt = s1 + size;
+
+    if (jj == NULL)
+        fft_precache(ii, F->depth, limbs, 4*n, &t1, &t2, &s1);
+    else
+        fft_convolution_precache(ii, jj, F->depth, limbs, 4*n,
+                                                     &t1, &t2, &s1, &tt);
+}
+
+void nmod_poly_fft_image_init(nmod_poly_fft_image_t F, slong len, nmod_t mod)
+{
+    F->bits = 2*FLINT_BIT_COUNT(mod.n - 1) + FLINT_BIT_COUNT(len);
+    F->m = fft_mulmod_2expm1_params(&F->depth, &F->w, len, F->bits);
+    F->len = 4*(WORD(1) << F->depth)*F->m;
+    F->ii = _fft_image_alloc(F);
+}
+
+void nmod_poly_fft_image_clear(nmod_poly_fft_image_t F)
+{
+    flint_free(F->ii);
+}
+
+void _nmod_poly_fft_image_set(nmod_poly_fft_image_t F, mp_srcptr poly,
+                                                    slong len, nmod_t mod)
+{
+    _fft_image_transform(F->ii, NULL, poly, len, F, mod);
+}
+
+void _nmod_poly_fft_image_mul(mp_ptr res, slong lo, slong hi,
+                              mp_srcptr poly, slong len,
+                              const nmod_poly_fft_image_t F, nmod_t mod)
+{
+    slong n = WORD(1) << F->depth;
+    slong limbs = (n*F->w)/FLINT_BITS;
+    slong tl = ((4*n + 1)*F->m*F->bits)/FLINT_BITS + limbs + 2;
+    slong L = F->len, i;
+    mp_limb_t ** ii;
+    mp_ptr t, T;
+
+    FLINT_ASSERT(0 <= lo && lo <= hi && hi <= L);
+
+    ii = _fft_image_alloc(F);
+    _fft_image_transform(ii, F->ii, poly, len, F, mod);
+
+    t = flint_calloc(tl, sizeof(mp_limb_t));
+    fft_combine_bits(t, ii, 4*n, F->m*F->bits, limbs, tl);
+    flint_free(ii);
+
+    /* the top FFT coefficient carries into x^L, ..., x^(L + m - 2) */
+    T = _nmod_vec_init(L + F->m - 1);
+    _nmod_poly_bit_unpack(T, L + F->m - 1, t, F->bits, mod);
+    flint_free(t);
+
+    for (i = 0; i < F->m - 1; i++)
+        T[i] = nmod_add(T[i], T[L + i], mod);
+
+    _nmod_vec_set(res, T + lo, hi - lo);
+    _nmod_vec_clear(T);
+}
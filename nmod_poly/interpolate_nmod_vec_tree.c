@@ -0,0 +1,118 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+_nmod_poly_interpolate_nmod_vec_tree_vec(mp_ptr * polys,
+                   const mp_srcptr * ys, slong num, const nmod_poly_tree_t T)
+{
+    const slong len = T->length;
+    const nmod_t mod = T->mod;
+    mp_ptr t, u, pa;
+    slong i, j, k, pow, left;
+
+    if (len == 0 || num == 0)
+        return;
+
+    if (T->weights == NULL)
+    {
+        flint_printf("Exception (nmod_poly_interpolate_nmod_vec_tree). "
+                     "Interpolation weights not invertible.\n");
+        flint_abort();
+    }
+
+    for (k = 0; k < num; k++)
+        for (i = 0; i < len; i++)
+            polys[k][i] = nmod_mul(T->weights[i], ys[k][i], mod);
+
+    t = _nmod_vec_init(len);
+    u = _nmod_vec_init(len);
+
+    /*
+        Combine level by level, applying each node to all polynomials
+        before moving on to the next.
+    */
+    for (i = 0; i < FLINT_CLOG2(len); i++)
+    {
+        pow = (WORD(1) << i);
+        pa = T->tree[i];
+        left = len;
+
+        for (j = 0; left >= 2 * pow; j += 2 * pow)
+        {
+            for (k = 0; k < num; k++)
+            {
+                mp_ptr pb = polys[k] + j;
+
+                _nmod_poly_mul(t, pa, pow + 1, pb + pow, pow, mod);
+                _nmod_poly_mul(u, pa + pow + 1, pow + 1, pb, pow, mod);
+                _nmod_vec_add(pb, t, u, 2 * pow, mod);
+            }
+
+            left -= 2 * pow;
+            pa += 2 * pow + 2;
+        }
+
+        if (left > pow)
+        {
+            for (k = 0; k < num; k++)
+            {
+                mp_ptr pb = polys[k] + j;
+
+                _nmod_poly_mul(t, pa, pow + 1, pb + pow, left - pow, mod);
+                _nmod_poly_mul(u, pb, pow, pa + pow + 1, left - pow + 1, mod);
+                _nmod_vec_add(pb, t, u, left, mod);
+            }
+        }
+    }
+
+    _nmod_vec_clear(t);
+    _nmod_vec_clear(u);
+}
+
+void
+nmod_poly_interpolate_nmod_vec_tree(nmod_poly_t poly,
+                                  mp_srcptr ys, const nmod_poly_tree_t T)
+{
+    nmod_poly_interpolate_nmod_vec_tree_vec(poly, &ys, 1, T);
+}
+
+void
+nmod_poly_interpolate_nmod_vec_tree_vec(nmod_poly_struct * polys,
+                   const mp_srcptr * ys, slong num, const nmod_poly_tree_t T)
+{
+    const slong len = T->length;
+    mp_ptr * p;
+    slong k;
+
+    p = flint_malloc(sizeof(mp_ptr) * num);
+
+    for (k = 0; k < num; k++)
+    {
+        nmod_poly_fit_length(polys + k, len);
+        p[k] = polys[k].coeffs;
+    }
+
+    _nmod_poly_interpolate_nmod_vec_tree_vec(p, ys, num, T);
+
+    for (k = 0; k < num; k++)
+    {
+        _nmod_poly_set_length(polys + k, len);
+        _nmod_poly_normalise(polys + k);
+    }
+
+    flint_free(p);
+}
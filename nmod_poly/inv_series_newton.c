@@ -62,10 +62,37 @@ _nmod_poly_inv_series_newton(mp_ptr Qinv, mp_srcptr Q, slong Qlen, slong n, nmod
             n = a[i];
 
             Qnlen = FLINT_MIN(Qlen, n);
-            Wlen = FLINT_MIN(Qnlen + m - 1, n);
-            W2len = Wlen - m;
-            MULLOW(W, Q, Qnlen, Qinv, m, Wlen, mod);
-            MULLOW(Qinv + m, Qinv, m, W + m, W2len, n - m, mod);
+
+            if (n*(2*FLINT_BIT_COUNT(mod.n - 1) + FLINT_BIT_COUNT(n))
+                                >= NMOD_POLY_NEWTON_FFT_CUTOFF*FLINT_BITS)
+            {
+                /*
+                   Both products use the transform of Qinv. Modulo x^L - 1
+                   with L >= n, coefficients m to n - 1 of Q*Qinv do not
+                   wrap around and the second product is short.
+                */
+                nmod_poly_fft_image_t G;
+
+                nmod_poly_fft_image_init(G, n, mod);
+                _nmod_poly_fft_image_set(G, Qinv, m, mod);
+                _nmod_poly_fft_image_mul(W, m, n, Q, Qnlen, G, mod);
+                _nmod_poly_fft_image_mul(Qinv + m, 0, n - m, W, n - m, G, mod);
+                nmod_poly_fft_image_clear(G);
+            }
+            else if (Qnlen == n)
+            {
+                /* the low m coefficients of Q*Qinv are known to be 1, 0, ... */
+                _nmod_poly_mulmid(W, Q, n, Qinv, m, mod);
+                MULLOW(Qinv + m, Qinv, m, W + 1, n - m, n - m, mod);
+            }
+            else
+            {
+                Wlen = FLINT_MIN(Qnlen + m - 1, n);
+                W2len = Wlen - m;
+                MULLOW(W, Q, Qnlen, Qinv, m, Wlen, mod);
+                MULLOW(Qinv + m, Qinv, m, W + m, W2len, n - m, mod);
+            }
+
             _nmod_vec_neg(Qinv + m, Qinv + m, n - m, mod);
         }
 
@@ -37,17 +37,46 @@ __nmod_poly_invsqrt_series_prealloc(mp_ptr g,
 
     __nmod_poly_invsqrt_series_prealloc(g, h, t, u, m, mod);
 
-    _nmod_vec_zero(g + m, n - m);
+    c = n_invmod(mod.n - 2, mod.n);
+
+    if (n*(2*FLINT_BIT_COUNT(mod.n - 1) + FLINT_BIT_COUNT(n))
+                                >= NMOD_POLY_NEWTON_FFT_CUTOFF*FLINT_BITS)
+    {
+        /*
+           With t = g^2 we have h t = 1 + O(x^m), so g (h t - 1) needs
+           only coefficients m to n - 1 of h t; these do not wrap around
+           modulo x^L - 1 for L >= 2n - m - 1. The square and the final
+           product share the transform of g.
+        */
+        nmod_poly_fft_image_t G, S;
+
+        nmod_poly_fft_image_init(G, n, mod);
+        _nmod_poly_fft_image_set(G, g, m, mod);
+        _nmod_poly_fft_image_mul(t, 0, n, g, m, G, mod);
+
+        nmod_poly_fft_image_init(S, 2*n - m - 1, mod);
+        _nmod_poly_fft_image_set(S, t, n, mod);
+        _nmod_poly_fft_image_mul(u, m, n, h, n, S, mod);
+        nmod_poly_fft_image_clear(S);
+
+        _nmod_poly_fft_image_mul(t, 0, n - m, u, n - m, G, mod);
+        nmod_poly_fft_image_clear(G);
+
+        _nmod_vec_scalar_mul_nmod(g + m, t, n - m, c, mod);
+    }
+    else
+    {
+        _nmod_vec_zero(g + m, n - m);
 
-    _nmod_poly_mul(t, g, m, g, m, mod);
-    if (2*m - 1 < n)
-        t[n-1] = UWORD(0);
+        _nmod_poly_mul(t, g, m, g, m, mod);
+        if (2*m - 1 < n)
+            t[n-1] = UWORD(0);
 
-    _nmod_poly_mullow(u, t, n, g, n, n, mod);
-    _nmod_poly_mullow(t, u, n, h, n, n, mod);
+        _nmod_poly_mullow(u, t, n, g, n, n, mod);
+        _nmod_poly_mullow(t, u, n, h, n, n, mod);
 
-    c = n_invmod(mod.n - 2, mod.n);
-    _nmod_vec_scalar_mul_nmod(g + m, t + m, n - m, c, mod);
+        _nmod_vec_scalar_mul_nmod(g + m, t + m, n - m, c, mod);
+    }
 
     if (alloc)
     {
@@ -31,6 +31,9 @@ void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, slong len1,
 
     if (2 * bits + bits2 <= FLINT_BITS && len1 + len2 < 16)
         _nmod_poly_mul_classical(res, poly1, len1, poly2, len2, mod);
+    else if (flint_get_num_threads() > 1 && len2 * (2 * bits + bits2)
+                              >= NMOD_POLY_MUL_THREADED_CUTOFF * FLINT_BITS)
+        _nmod_poly_mul_KS(res, poly1, len1, poly2, len2, 0, mod);
     else if (bits * len2 > 2000)
         _nmod_poly_mul_KS4(res, poly1, len1, poly2, len2, mod);
     else if (bits * len2 > 200)
@@ -15,6 +15,7 @@
 #include "flint.h"
 #include "nmod_vec.h"
 #include "nmod_poly.h"
+#include "fft.h"
 
 void
 _nmod_poly_mullow_KS(mp_ptr out, mp_srcptr in1, slong len1,
@@ -22,6 +23,7 @@ _nmod_poly_mullow_KS(mp_ptr out, mp_srcptr in1, slong len1,
 {
     slong limbs1, limbs2;
     mp_ptr mpn1, mpn2, res;
+    int threaded;
 
     len1 = FLINT_MIN(len1, n);
     len2 = FLINT_MIN(len2, n);
@@ -42,15 +44,38 @@ _nmod_poly_mullow_KS(mp_ptr out, mp_srcptr in1, slong len1,
     mpn1 = (mp_ptr) flint_malloc(sizeof(mp_limb_t) * limbs1);
     mpn2 = (in1 == in2) ? mpn1 : (mp_ptr) flint_malloc(sizeof(mp_limb_t) * limbs2);
 
-    _nmod_poly_bit_pack(mpn1, in1, len1, bits);
-    if (in1 != in2)
-        _nmod_poly_bit_pack(mpn2, in2, len2, bits);
+    /* every stage can use the thread pool for very large products */
+    threaded = flint_get_num_threads() > 1 &&
+               FLINT_MIN(limbs1, limbs2) >= NMOD_POLY_MUL_THREADED_CUTOFF;
+
+    if (threaded)
+    {
+        _nmod_poly_bit_pack_threaded(mpn1, in1, len1, bits);
+        if (in1 != in2)
+            _nmod_poly_bit_pack_threaded(mpn2, in2, len2, bits);
+    } else
+    {
+        _nmod_poly_bit_pack(mpn1, in1, len1, bits);
+        if (in1 != in2)
+            _nmod_poly_bit_pack(mpn2, in2, len2, bits);
+    }
 
     res = (mp_ptr) flint_malloc(sizeof(mp_limb_t) * (limbs1 + limbs2));
 
-    mpn_mul(res, mpn1, limbs1, mpn2, limbs2);
+    if (threaded)
+    {
+        if (limbs1 >= limbs2)
+            flint_mpn_mul_fft_main(res, mpn1, limbs1, mpn2, limbs2);
+        else
+            flint_mpn_mul_fft_main(res, mpn2, limbs2, mpn1, limbs1);
 
-    _nmod_poly_bit_unpack(out, n, res, bits, mod);
+        _nmod_poly_bit_unpack_threaded(out, n, res, bits, mod);
+    } else
+    {
+        mpn_mul(res, mpn1, limbs1, mpn2, limbs2);
+
+        _nmod_poly_bit_unpack(out, n, res, bits, mod);
+    }
     
     flint_free(mpn2);
     if (in1 != in2)
@@ -0,0 +1,85 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/* Assumes poly1 and poly2 are not length 0 and len1 >= len2. */
+void _nmod_poly_mulmid(mp_ptr res, mp_srcptr poly1, slong len1,
+                             mp_srcptr poly2, slong len2, nmod_t mod)
+{
+    slong bits, limbs1, len_out = len1 - len2 + 1;
+
+    bits = 2 * (FLINT_BITS - (slong) mod.norm) + FLINT_BIT_COUNT(len2);
+
+    if (len2 <= 6 || len_out <= 6 ||
+        len2 * len_out <= (bits <= FLINT_BITS ? 8192 : 65536))
+    {
+        _nmod_poly_mulmid_classical(res, poly1, len1, poly2, len2, mod);
+        return;
+    }
+
+    limbs1 = (len1 * bits - 1) / FLINT_BITS + 1;
+
+    if (limbs1 >= NMOD_POLY_MULMID_FFT_CUTOFF)
+    {
+        _nmod_poly_mulmid_KS(res, poly1, len1, poly2, len2, 0, mod);
+    }
+    else
+    {
+        /* below the cutoff the full product is no slower */
+        mp_ptr t = _nmod_vec_init(len1 + len2 - 1);
+
+        _nmod_poly_mul(t, poly1, len1, poly2, len2, mod);
+        _nmod_vec_set(res, t + len2 - 1, len_out);
+
+        _nmod_vec_clear(t);
+    }
+}
+
+void nmod_poly_mulmid(nmod_poly_t res,
+                      const nmod_poly_t poly1, const nmod_poly_t poly2)
+{
+    slong len1, len2, len_out;
+
+    len1 = poly1->length;
+    len2 = poly2->length;
+
+    if (len1 == 0 || len2 == 0 || len1 < len2)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    len_out = len1 - len2 + 1;
+
+    if (res == poly1 || res == poly2)
+    {
+        nmod_poly_t temp;
+
+        nmod_poly_init2(temp, poly1->mod.n, len_out);
+        _nmod_poly_mulmid(temp->coeffs, poly1->coeffs, len1,
+                                        poly2->coeffs, len2, poly1->mod);
+        nmod_poly_swap(temp, res);
+        nmod_poly_clear(temp);
+    } else
+    {
+        nmod_poly_fit_length(res, len_out);
+        _nmod_poly_mulmid(res->coeffs, poly1->coeffs, len1,
+                                       poly2->coeffs, len2, poly1->mod);
+    }
+
+    res->length = len_out;
+    _nmod_poly_normalise(res);
+}
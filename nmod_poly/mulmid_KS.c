@@ -0,0 +1,140 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "fft.h"
+
+/*
+    Assumes poly1 and poly2 are not length 0 and len1 >= len2.
+
+    The output coefficients of the middle product only depend on the
+    product modulo x^len1 - 1 (coefficients len2 - 1 to len1 - 1 of the
+    full product are unaffected by the wraparound of the top len2 - 1
+    coefficients). With bits chosen as in the full product, at most len2
+    terms contribute to each field of the wrapped product, so there are no
+    carries between fields. For large operands we can therefore use a
+    cyclic FFT of half the usual length, working modulo 2^N - 1.
+*/
+void
+_nmod_poly_mulmid_KS(mp_ptr out, mp_srcptr in1, slong len1,
+                     mp_srcptr in2, slong len2, flint_bitcnt_t bits, nmod_t mod)
+{
+    slong limbs1, limbs2, r_limbs, off;
+    mp_ptr mpn1, mpn2, res;
+    int sqr = (in1 == in2 && len1 == len2);
+
+    if (bits == 0)
+    {
+        flint_bitcnt_t bits1, bits2, loglen;
+        bits1  = _nmod_vec_max_bits(in1, len1);
+        bits2  = sqr ? bits1 : _nmod_vec_max_bits(in2, len2);
+        loglen = FLINT_BIT_COUNT(len2);
+
+        bits = bits1 + bits2 + loglen;
+    }
+
+    limbs1 = (len1 * bits - 1) / FLINT_BITS + 1;
+    limbs2 = (len2 * bits - 1) / FLINT_BITS + 1;
+
+    if (limbs1 < NMOD_POLY_MULMID_FFT_CUTOFF)
+    {
+        mpn1 = (mp_ptr) flint_malloc(sizeof(mp_limb_t) * limbs1);
+        mpn2 = sqr ? mpn1 :
+                         (mp_ptr) flint_malloc(sizeof(mp_limb_t) * limbs2);
+
+        _nmod_poly_bit_pack(mpn1, in1, len1, bits);
+        if (!sqr)
+            _nmod_poly_bit_pack(mpn2, in2, len2, bits);
+
+        r_limbs = limbs1 + limbs2;
+        res = (mp_ptr) flint_malloc(sizeof(mp_limb_t) * r_limbs);
+
+        if (sqr)
+            mpn_sqr(res, mpn1, limbs1);
+        else
+            mpn_mul(res, mpn1, limbs1, mpn2, limbs2);
+    }
+    else
+    {
+        flint_bitcnt_t depth, w;
+        mp_size_t m;
+
+        m = fft_mulmod_2expm1_params(&depth, &w, len1, bits);
+        r_limbs = ((UWORD(4) << depth) * m * bits - 1) / FLINT_BITS + 1;
+
+        mpn1 = (mp_ptr) flint_calloc(r_limbs, sizeof(mp_limb_t));
+        mpn2 = sqr ? mpn1 :
+                         (mp_ptr) flint_calloc(r_limbs, sizeof(mp_limb_t));
+
+        _nmod_poly_bit_pack(mpn1, in1, len1, bits);
+        if (!sqr)
+            _nmod_poly_bit_pack(mpn2, in2, len2, bits);
+
+        res = (mp_ptr) flint_malloc(sizeof(mp_limb_t) * r_limbs);
+
+        fft_mulmod_2expm1(res, mpn1, limbs1, mpn2, limbs2, m * bits, depth, w);
+    }
+
+    /* extract the fields len2 - 1, ..., len1 - 1 */
+    off = (len2 - 1) * bits;
+    if (off % FLINT_BITS != 0)
+        mpn_rshift(res + off / FLINT_BITS, res + off / FLINT_BITS,
+                         r_limbs - off / FLINT_BITS, off % FLINT_BITS);
+
+    _nmod_poly_bit_unpack(out, len1 - len2 + 1,
+                                           res + off / FLINT_BITS, bits, mod);
+
+    flint_free(mpn1);
+    if (!sqr)
+        flint_free(mpn2);
+
+    flint_free(res);
+}
+
+void
+nmod_poly_mulmid_KS(nmod_poly_t res,
+                 const nmod_poly_t poly1, const nmod_poly_t poly2,
+                 flint_bitcnt_t bits)
+{
+    slong len_out;
+
+    if (poly1->length == 0 || poly2->length == 0 ||
+        poly1->length < poly2->length)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    len_out = poly1->length - poly2->length + 1;
+
+    if (res == poly1 || res == poly2)
+    {
+        nmod_poly_t temp;
+        nmod_poly_init2_preinv(temp, poly1->mod.n, poly1->mod.ninv, len_out);
+        _nmod_poly_mulmid_KS(temp->coeffs, poly1->coeffs, poly1->length,
+                             poly2->coeffs, poly2->length, bits, poly1->mod);
+        nmod_poly_swap(res, temp);
+        nmod_poly_clear(temp);
+    }
+    else
+    {
+        nmod_poly_fit_length(res, len_out);
+        _nmod_poly_mulmid_KS(res->coeffs, poly1->coeffs, poly1->length,
+                             poly2->coeffs, poly2->length, bits, poly1->mod);
+    }
+
+    res->length = len_out;
+    _nmod_poly_normalise(res);
+}
@@ -0,0 +1,70 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void _nmod_poly_mulmod_precomp(mp_ptr res, mp_srcptr poly1, slong len1,
+                               mp_srcptr poly2, slong len2,
+                               const nmod_poly_rem_precomp_t P)
+{
+    mp_ptr T;
+    slong lenT = len1 + len2 - 1;
+
+    T = _nmod_vec_init(lenT);
+
+    if (len1 >= len2)
+        _nmod_poly_mul(T, poly1, len1, poly2, len2, P->mod);
+    else
+        _nmod_poly_mul(T, poly2, len2, poly1, len1, P->mod);
+
+    _nmod_poly_rem_precomp(res, T, lenT, P);
+
+    _nmod_vec_clear(T);
+}
+
+void nmod_poly_mulmod_precomp(nmod_poly_t res, const nmod_poly_t poly1,
+                              const nmod_poly_t poly2,
+                              const nmod_poly_rem_precomp_t P)
+{
+    slong len1, len2, lenf;
+
+    lenf = P->lenf;
+    len1 = poly1->length;
+    len2 = poly2->length;
+
+    if (lenf <= len1 || lenf <= len2)
+    {
+        flint_printf("Exception (nmod_poly_mulmod_precomp). Input larger than modulus.\n");
+        flint_abort();
+    }
+
+    if (lenf == 1 || len1 == 0 || len2 == 0)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    if (len1 + len2 - lenf > 0)
+    {
+        nmod_poly_fit_length(res, lenf - 1);
+        _nmod_poly_mulmod_precomp(res->coeffs, poly1->coeffs, len1,
+                                             poly2->coeffs, len2, P);
+        res->length = lenf - 1;
+        _nmod_poly_normalise(res);
+    }
+    else
+    {
+        nmod_poly_mul(res, poly1, poly2);
+    }
+}
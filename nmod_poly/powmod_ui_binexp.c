@@ -32,6 +32,20 @@ _nmod_poly_powmod_ui_binexp(mp_ptr res, mp_srcptr poly,
         return;
     }
 
+    /* large moduli: precompute the inverse and reuse its transforms */
+    if ((lenf - 1)*(2*FLINT_BIT_COUNT(mod.n - 1))
+                                >= NMOD_POLY_REM_PRECOMP_CUTOFF*FLINT_BITS)
+    {
+        mp_ptr finv = _nmod_vec_init(2*lenf);
+
+        _nmod_poly_reverse(finv + lenf, f, lenf, lenf);
+        _nmod_poly_inv_series(finv, finv + lenf, lenf, lenf, mod);
+        _nmod_poly_powmod_ui_binexp_preinv(res, poly, e, f, lenf,
+                                           finv, lenf, mod);
+        _nmod_vec_clear(finv);
+        return;
+    }
+
     lenT = 2 * lenf - 3;
     lenQ = FLINT_MAX(lenT - lenf + 1, 1);
 
@@ -33,8 +33,9 @@ _nmod_poly_powmod_ui_binexp_preinv (mp_ptr res, mp_srcptr poly,
                                     ulong e, mp_srcptr f, slong lenf,
                                     mp_srcptr finv, slong lenfinv, nmod_t mod)
 {
-    mp_ptr T, Q;
-    slong lenT, lenQ;
+    nmod_poly_rem_precomp_t P;
+    mp_ptr T;
+    slong lenT;
     int i;
 
     if (lenf == 2)
@@ -44,27 +45,25 @@ _nmod_poly_powmod_ui_binexp_preinv (mp_ptr res, mp_srcptr poly,
     }
 
     lenT = 2 * lenf - 3;
-    lenQ = FLINT_MAX(lenT - lenf + 1, 1);
 
-    T = _nmod_vec_init(lenT + lenQ);
-    Q = T + lenT;
+    T = _nmod_vec_init(lenT);
+    _nmod_poly_rem_precomp_init(P, f, lenf, finv, lenfinv, mod);
 
     _nmod_vec_set(res, poly, lenf - 1);
 
     for (i = ((int) FLINT_BIT_COUNT(e) - 2); i >= 0; i--)
     {
         _nmod_poly_mul(T, res, lenf - 1, res, lenf - 1, mod);
-        _nmod_poly_divrem_newton_n_preinv(Q, res, T, 2 * lenf - 3, f,
-                                          lenf, finv, lenfinv, mod);
+        _nmod_poly_rem_precomp(res, T, 2 * lenf - 3, P);
 
         if (e & (UWORD(1) << i))
         {
             _nmod_poly_mul(T, res, lenf - 1, poly, lenf - 1, mod);
-            _nmod_poly_divrem_newton_n_preinv(Q, res, T, 2 * lenf - 3, f,
-                                              lenf, finv, lenfinv, mod);
+            _nmod_poly_rem_precomp(res, T, 2 * lenf - 3, P);
         }
     }
 
+    nmod_poly_rem_precomp_clear(P);
     _nmod_vec_clear(T);
 }
 
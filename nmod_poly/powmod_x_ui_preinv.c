@@ -33,15 +33,15 @@ void
 _nmod_poly_powmod_x_ui_preinv (mp_ptr res, ulong e, mp_srcptr f, slong lenf,
                                mp_srcptr finv, slong lenfinv, nmod_t mod)
 {
-    mp_ptr T, Q;
-    slong lenT, lenQ, window;
+    nmod_poly_rem_precomp_t P;
+    mp_ptr T;
+    slong lenT, window;
     int i, l, c;
 
     lenT = 2 * lenf - 3;
-    lenQ = FLINT_MAX(lenT - lenf + 1, 1);
 
-    T = _nmod_vec_init(lenT + lenQ);
-    Q = T + lenT;
+    T = _nmod_vec_init(lenT);
+    _nmod_poly_rem_precomp_init(P, f, lenf, finv, lenfinv, mod);
 
     flint_mpn_zero (res, lenf - 1);
     res[0] = WORD(1);
@@ -62,8 +62,7 @@ _nmod_poly_powmod_x_ui_preinv (mp_ptr res, ulong e, mp_srcptr f, slong lenf,
     if (c == 0)
     {
         _nmod_poly_shift_left(T, res, lenf - 1, window);
-        _nmod_poly_divrem_newton_n_preinv(Q, res, T, lenf - 1 + window, f,
-                                          lenf, finv, lenfinv, mod);
+        _nmod_poly_rem_precomp(res, T, lenf - 1 + window, P);
         c = l + 1;
         window= WORD(0);
     }
@@ -71,8 +70,7 @@ _nmod_poly_powmod_x_ui_preinv (mp_ptr res, ulong e, mp_srcptr f, slong lenf,
     for (; i >= 0; i--)
     {
         _nmod_poly_mul(T, res, lenf - 1, res, lenf - 1, mod);
-        _nmod_poly_divrem_newton_n_preinv(Q, res, T, 2 * lenf - 3, f,
-                                          lenf, finv, lenfinv, mod);
+        _nmod_poly_rem_precomp(res, T, 2 * lenf - 3, P);
 
         c--;
         if (e & (UWORD(1) << i))
@@ -87,14 +85,14 @@ _nmod_poly_powmod_x_ui_preinv (mp_ptr res, ulong e, mp_srcptr f, slong lenf,
         if (c == 0)
         {
             _nmod_poly_shift_left(T, res, lenf - 1, window);
-            _nmod_poly_divrem_newton_n_preinv(Q, res, T, lenf - 1 + window, f,
-                                              lenf, finv, lenfinv, mod);
+            _nmod_poly_rem_precomp(res, T, lenf - 1 + window, P);
 
             c= l + 1;
             window= WORD(0);
         }
     }
 
+    nmod_poly_rem_precomp_clear(P);
     _nmod_vec_clear(T);
 }
 
@@ -0,0 +1,160 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void _nmod_poly_rem_precomp_init(nmod_poly_rem_precomp_t P,
+                     mp_srcptr f, slong lenf, mp_srcptr finv, slong lenfinv,
+                                                                 nmod_t mod)
+{
+    slong d = lenf - 1;
+
+    P->f = _nmod_vec_init(lenf);
+    P->finv = _nmod_vec_init(lenfinv);
+    _nmod_vec_set(P->f, f, lenf);
+    _nmod_vec_set(P->finv, finv, lenfinv);
+    P->lenf = lenf;
+    P->lenfinv = lenfinv;
+    P->mod = mod;
+    P->fft = (d*(2*FLINT_BIT_COUNT(mod.n - 1) + FLINT_BIT_COUNT(d))
+                                >= NMOD_POLY_REM_PRECOMP_CUTOFF*FLINT_BITS);
+
+    if (P->fft)
+    {
+        slong lenI = FLINT_MIN(lenfinv, d - 1);
+
+        /* the product of the top of A with finv, no wraparound */
+        nmod_poly_fft_image_init(P->finv_fft, 2*d - 1, mod);
+        _nmod_poly_fft_image_set(P->finv_fft, finv, lenI, mod);
+
+        /* the product Q f modulo x^L - 1, which determines R for L >= d */
+        nmod_poly_fft_image_init(P->f_fft, d, mod);
+        _nmod_poly_fft_image_set(P->f_fft, f, lenf, mod);
+    }
+}
+
+void nmod_poly_rem_precomp_init(nmod_poly_rem_precomp_t P,
+                              const nmod_poly_t f, const nmod_poly_t finv)
+{
+    if (f->length == 0)
+    {
+        flint_printf("Exception (nmod_poly_rem_precomp_init). Division by zero.\n");
+        flint_abort();
+    }
+
+    _nmod_poly_rem_precomp_init(P, f->coeffs, f->length,
+                                   finv->coeffs, finv->length, f->mod);
+}
+
+void nmod_poly_rem_precomp_clear(nmod_poly_rem_precomp_t P)
+{
+    _nmod_vec_clear(P->f);
+    _nmod_vec_clear(P->finv);
+
+    if (P->fft)
+    {
+        nmod_poly_fft_image_clear(P->finv_fft);
+        nmod_poly_fft_image_clear(P->f_fft);
+    }
+}
+
+void _nmod_poly_rem_precomp(mp_ptr R, mp_srcptr A, slong lenA,
+                                        const nmod_poly_rem_precomp_t P)
+{
+    const slong d = P->lenf - 1, lenQ = lenA - d;
+    const nmod_t mod = P->mod;
+    mp_ptr Q, T;
+    slong i, L;
+
+    if (lenA <= d)
+    {
+        _nmod_vec_set(R, A, lenA);
+        flint_mpn_zero(R + lenA, d - lenA);
+        return;
+    }
+
+    Q = _nmod_vec_init(lenQ);
+
+    if (!P->fft)
+    {
+        _nmod_poly_divrem_newton_n_preinv(Q, R, A, lenA, P->f, P->lenf,
+                                          P->finv, P->lenfinv, mod);
+        _nmod_vec_clear(Q);
+        return;
+    }
+
+    FLINT_ASSERT(lenQ <= d - 1 && lenQ <= P->lenfinv);
+
+    /* Q = rev(rev(A) finv mod x^lenQ) */
+    _nmod_poly_reverse(Q, A + d, lenQ, lenQ);
+    _nmod_poly_fft_image_mul(Q, 0, lenQ, Q, lenQ, P->finv_fft, mod);
+    _nmod_poly_reverse(Q, Q, lenQ, lenQ);
+
+    /* R = A - Q f, computed modulo x^L - 1 */
+    L = P->f_fft->len;
+    T = _nmod_vec_init(d);
+    _nmod_poly_fft_image_mul(T, 0, d, Q, lenQ, P->f_fft, mod);
+
+    _nmod_vec_sub(R, A, T, d, mod);
+    for (i = L; i < lenA; i++)
+        R[i - L] = nmod_add(R[i - L], A[i], mod);
+
+    _nmod_vec_clear(T);
+    _nmod_vec_clear(Q);
+}
+
+void nmod_poly_rem_precomp(nmod_poly_t R, const nmod_poly_t A,
+                                        const nmod_poly_rem_precomp_t P)
+{
+    const slong lenA = A->length, lenf = P->lenf;
+    mp_ptr r;
+
+    if (lenf == 1)
+    {
+        nmod_poly_zero(R);
+        return;
+    }
+
+    if (lenA >= lenf && lenA > 2*lenf - 3)
+    {
+        flint_printf("Exception (nmod_poly_rem_precomp). Input too long.\n");
+        flint_abort();
+    }
+
+    if (lenA < lenf)
+    {
+        nmod_poly_set(R, A);
+        return;
+    }
+
+    if (R == A)
+        r = _nmod_vec_init(lenf - 1);
+    else
+    {
+        nmod_poly_fit_length(R, lenf - 1);
+        r = R->coeffs;
+    }
+
+    _nmod_poly_rem_precomp(r, A->coeffs, lenA, P);
+
+    if (R == A)
+    {
+        _nmod_vec_clear(R->coeffs);
+        R->coeffs = r;
+        R->alloc = lenf - 1;
+    }
+
+    R->length = lenf - 1;
+    _nmod_poly_normalise(R);
+}
@@ -0,0 +1,84 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("bit_pack_threaded/bit_unpack_threaded....");
+    fflush(stdout);
+
+    /* Check against the unthreaded versions */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b;
+        mp_limb_t n;
+        ulong bits;
+        slong limbs;
+        mp_ptr mpn1, mpn2;
+
+        flint_set_num_threads(n_randint(state, 5) + 1);
+
+        do
+        {
+            n = n_randtest_not_zero(state);
+        } while (n == 1);
+        bits = 2 * FLINT_BIT_COUNT(n) + n_randint(state, FLINT_BITS);
+        bits = FLINT_MIN(bits, 3 * FLINT_BITS - 1);
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        do
+        {
+            nmod_poly_randtest(a, state, n_randint(state, 1000));
+        } while (a->length == 0);
+
+        limbs = (bits * a->length - 1) / FLINT_BITS + 1;
+        mpn1 = flint_malloc(sizeof(mp_limb_t) * limbs);
+        mpn2 = flint_malloc(sizeof(mp_limb_t) * limbs);
+
+        _nmod_poly_bit_pack(mpn1, a->coeffs, a->length, bits);
+        _nmod_poly_bit_pack_threaded(mpn2, a->coeffs, a->length, bits);
+
+        nmod_poly_fit_length(b, a->length);
+        _nmod_poly_bit_unpack_threaded(b->coeffs, a->length, mpn2, bits, a->mod);
+        b->length = a->length;
+
+        result = (mpn_cmp(mpn1, mpn2, limbs) == 0 && nmod_poly_equal(a, b));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("bits = %wu, len = %wd\n", bits, a->length);
+            nmod_poly_print(a), flint_printf("\n\n");
+            nmod_poly_print(b), flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        flint_free(mpn1);
+        flint_free(mpn2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
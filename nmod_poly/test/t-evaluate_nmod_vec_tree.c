@@ -0,0 +1,107 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result = 1;
+    FLINT_TEST_INIT(state);
+    
+    flint_printf("evaluate_nmod_vec_tree....");
+    fflush(stdout);
+
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_tree_t T;
+        nmod_poly_struct * P;
+        mp_ptr x, y, * z;
+        mp_limb_t mod;
+        slong j, k, num, npoints;
+
+        mod = n_randtest_prime(state, 0);
+        npoints = n_randint(state, 100);
+        if (n_randint(state, 10) == 0)
+            npoints += n_randint(state, 600);
+        num = n_randint(state, 5) + 1;
+
+        x = _nmod_vec_init(npoints);
+        y = _nmod_vec_init(npoints);
+        P = flint_malloc(sizeof(nmod_poly_struct) * num);
+        z = flint_malloc(sizeof(mp_ptr) * num);
+
+        for (j = 0; j < npoints; j++)
+            x[j] = n_randint(state, mod);
+
+        nmod_poly_tree_init(T, x, npoints, mod);
+
+        for (k = 0; k < num; k++)
+        {
+            nmod_poly_init(P + k, mod);
+            nmod_poly_randtest(P + k, state, n_randint(state, 2 * npoints + 2));
+            z[k] = _nmod_vec_init(npoints);
+        }
+
+        nmod_poly_evaluate_nmod_vec_tree_vec(z, P, num, T);
+
+        for (k = 0; k < num; k++)
+        {
+            nmod_poly_evaluate_nmod_vec_iter(y, P + k, x, npoints);
+
+            result = _nmod_vec_equal(y, z[k], npoints);
+
+            if (!result)
+            {
+                flint_printf("FAIL (vec):\n");
+                flint_printf("mod=%wu, k=%wd, npoints=%wd\n\n", mod, k, npoints);
+                flint_printf("P: "); nmod_poly_print(P + k); flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        /* single polynomial */
+        nmod_poly_evaluate_nmod_vec_tree(z[0], P + num - 1, T);
+        nmod_poly_evaluate_nmod_vec_iter(y, P + num - 1, x, npoints);
+
+        result = _nmod_vec_equal(y, z[0], npoints);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("mod=%wu, npoints=%wd\n\n", mod, npoints);
+            flint_printf("P: "); nmod_poly_print(P + num - 1); flint_printf("\n\n");
+            abort();
+        }
+
+        for (k = 0; k < num; k++)
+        {
+            nmod_poly_clear(P + k);
+            _nmod_vec_clear(z[k]);
+        }
+
+        nmod_poly_tree_clear(T);
+        flint_free(P);
+        flint_free(z);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
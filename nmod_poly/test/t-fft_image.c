@@ -0,0 +1,103 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("fft_image....");
+    fflush(stdout);
+
+    /* Check against the product reduced modulo x^L - 1 */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b, c;
+        nmod_poly_fft_image_t F;
+        mp_ptr r, s;
+        slong len, L, lo, hi, k;
+
+        mp_limb_t n = n_randtest_not_zero(state);
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+
+        len = n_randint(state, 3000) + 1;
+        nmod_poly_fft_image_init(F, len, a->mod);
+        L = F->len;
+
+        /* b may be longer than L, in which case it is folded */
+        do {
+            nmod_poly_randtest(b, state, n_randint(state, 2*L) + 1);
+        } while (b->length == 0);
+
+        _nmod_poly_fft_image_set(F, b->coeffs, b->length, b->mod);
+
+        r = _nmod_vec_init(L);
+        s = _nmod_vec_init(L);
+
+        for (j = 0; j < 2; j++)
+        {
+            do {
+                nmod_poly_randtest(a, state, n_randint(state, len) + 1);
+            } while (a->length == 0);
+
+            nmod_poly_mul(c, a, b);
+
+            _nmod_vec_zero(s, L);
+            for (k = 0; k < c->length; k++)
+                s[k % L] = nmod_add(s[k % L], c->coeffs[k], c->mod);
+
+            lo = n_randint(state, L + 1);
+            hi = lo + n_randint(state, L - lo + 1);
+
+            if (n_randint(state, 2) && hi - lo >= a->length)
+            {
+                _nmod_vec_set(r, a->coeffs, a->length);
+                _nmod_poly_fft_image_mul(r, lo, hi, r, a->length, F, a->mod);
+            }
+            else
+                _nmod_poly_fft_image_mul(r, lo, hi, a->coeffs, a->length,
+                                                               F, a->mod);
+
+            result = _nmod_vec_equal(r, s + lo, hi - lo);
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("n = %wu, len = %wd, L = %wd, lo = %wd, hi = %wd\n",
+                                                           n, len, L, lo, hi);
+                abort();
+            }
+        }
+
+        _nmod_vec_clear(r);
+        _nmod_vec_clear(s);
+        nmod_poly_fft_image_clear(F);
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
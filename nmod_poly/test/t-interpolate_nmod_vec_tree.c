@@ -0,0 +1,213 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result = 1;
+    FLINT_TEST_INIT(state);
+    
+    flint_printf("interpolate_nmod_vec_tree....");
+    fflush(stdout);
+
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_tree_t T;
+        nmod_poly_struct * P, * Q;
+        mp_ptr x, * y;
+        mp_limb_t mod, a, b;
+        nmod_t m;
+        slong j, k, l, num, npoints;
+
+        mod = n_randtest_prime(state, 0);
+        nmod_init(&m, mod);
+        npoints = n_randint(state, FLINT_MIN(100, mod));
+        if (n_randint(state, 10) == 0)
+            npoints = n_randint(state, FLINT_MIN(700, mod));
+        num = n_randint(state, 5) + 1;
+
+        x = _nmod_vec_init(npoints);
+        y = flint_malloc(sizeof(mp_ptr) * num);
+        P = flint_malloc(sizeof(nmod_poly_struct) * num);
+        Q = flint_malloc(sizeof(nmod_poly_struct) * num);
+
+        if (n_randint(state, 2))
+        {
+            /* distinct points a*j + b */
+            a = n_randint(state, mod - 1) + 1;
+            b = n_randint(state, mod);
+            for (j = 0; j < npoints; j++)
+                x[j] = nmod_add(nmod_mul(a, j, m), b, m);
+        }
+        else
+        {
+            /* random distinct points */
+            for (j = 0; j < npoints; j++)
+            {
+                x[j] = n_randint(state, mod);
+                for (l = 0; l < j; l++)
+                    if (x[l] == x[j])
+                        break;
+                if (l < j)
+                    j--;
+            }
+        }
+
+        nmod_poly_tree_init(T, x, npoints, mod);
+
+        for (k = 0; k < num; k++)
+        {
+            nmod_poly_init(P + k, mod);
+            nmod_poly_init(Q + k, mod);
+            nmod_poly_randtest(P + k, state, n_randint(state, npoints + 1));
+            y[k] = _nmod_vec_init(npoints);
+        }
+
+        nmod_poly_evaluate_nmod_vec_tree_vec(y, P, num, T);
+        nmod_poly_interpolate_nmod_vec_tree_vec(Q, 
+                                           (const mp_srcptr *) y, num, T);
+
+        for (k = 0; k < num; k++)
+        {
+            result = nmod_poly_equal(P + k, Q + k);
+
+            if (!result)
+            {
+                flint_printf("FAIL (vec):\n");
+                flint_printf("mod=%wu, k=%wd, npoints=%wd\n\n", mod, k, npoints);
+                nmod_poly_print(P + k), flint_printf("\n\n");
+                nmod_poly_print(Q + k), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        nmod_poly_interpolate_nmod_vec_tree(Q, y[num - 1], T);
+
+        result = nmod_poly_equal(P + num - 1, Q);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("mod=%wu, npoints=%wd\n\n", mod, npoints);
+            nmod_poly_print(P + num - 1), flint_printf("\n\n");
+            nmod_poly_print(Q), flint_printf("\n\n");
+            abort();
+        }
+
+        for (k = 0; k < num; k++)
+        {
+            nmod_poly_clear(P + k);
+            nmod_poly_clear(Q + k);
+            _nmod_vec_clear(y[k]);
+        }
+
+        nmod_poly_tree_clear(T);
+        flint_free(P);
+        flint_free(Q);
+        flint_free(y);
+        _nmod_vec_clear(x);
+    }
+
+    /* repeated points and composite moduli have no weights */
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_tree_t T;
+        nmod_poly_t P;
+        mp_ptr x, y, z;
+        mp_limb_t mod;
+        nmod_t m;
+        slong j, npoints;
+        int distinct;
+
+        mod = n_randtest(state);
+        if (mod < 2)
+            mod = 2;
+        npoints = n_randint(state, 50) + 2;
+
+        x = _nmod_vec_init(npoints);
+        y = _nmod_vec_init(npoints);
+        z = _nmod_vec_init(npoints);
+
+        nmod_init(&m, mod);
+        _nmod_vec_randtest(x, state, npoints, m);
+
+        if (n_randint(state, 2))
+            x[n_randint(state, npoints)] = x[n_randint(state, npoints)];
+
+        /* all differences of points units mod n */
+        distinct = 1;
+        for (j = 0; j < npoints && distinct; j++)
+        {
+            slong l;
+            for (l = 0; l < j && distinct; l++)
+                distinct = (n_gcd(nmod_sub(x[j], x[l], m), mod) == 1);
+        }
+
+        nmod_poly_tree_init(T, x, npoints, mod);
+
+        if ((T->weights != NULL) != distinct)
+        {
+            flint_printf("FAIL (weights):\n");
+            flint_printf("mod=%wu, npoints=%wd, distinct=%d\n\n",
+                          mod, npoints, distinct);
+            abort();
+        }
+
+        /* evaluation still works */
+        nmod_poly_init(P, mod);
+        nmod_poly_randtest(P, state, n_randint(state, 2*npoints));
+        nmod_poly_evaluate_nmod_vec_tree(y, P, T);
+        nmod_poly_evaluate_nmod_vec(z, P, x, npoints);
+
+        if (!_nmod_vec_equal(y, z, npoints))
+        {
+            flint_printf("FAIL (evaluation):\n");
+            flint_printf("mod=%wu, npoints=%wd\n\n", mod, npoints);
+            abort();
+        }
+
+        if (distinct)
+        {
+            nmod_poly_t Q;
+            nmod_poly_init(Q, mod);
+
+            nmod_poly_interpolate_nmod_vec_tree(Q, y, T);
+            nmod_poly_evaluate_nmod_vec(z, Q, x, npoints);
+
+            if (Q->length > npoints || !_nmod_vec_equal(y, z, npoints))
+            {
+                flint_printf("FAIL (composite):\n");
+                flint_printf("mod=%wu, npoints=%wd\n\n", mod, npoints);
+                abort();
+            }
+
+            nmod_poly_clear(Q);
+        }
+
+        nmod_poly_clear(P);
+        nmod_poly_tree_clear(T);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+        _nmod_vec_clear(z);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
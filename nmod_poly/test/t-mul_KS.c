@@ -116,6 +116,41 @@ main(void)
         nmod_poly_clear(c);
     }
 
+    /* Check the threaded path for large products */
+    for (i = 0; i < 3; i++)
+    {
+        nmod_poly_t a1, a2, b, c;
+        mp_limb_t n = n_randtest_prime(state, 0);
+        slong len = (NMOD_POLY_MUL_THREADED_CUTOFF * FLINT_BITS)
+                               / (2 * FLINT_BIT_COUNT(n) + 18) + 1000;
+
+        nmod_poly_init(a1, n);
+        nmod_poly_init(a2, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+        nmod_poly_randtest(b, state, len + n_randint(state, 1000));
+        nmod_poly_randtest(c, state, len + n_randint(state, 1000));
+
+        flint_set_num_threads(1);
+        nmod_poly_mul_KS4(a1, b, c);
+
+        flint_set_num_threads(n_randint(state, 4) + 2);
+        nmod_poly_mul_KS(a2, b, c, 0);
+
+        result = (nmod_poly_equal(a1, a2));
+        if (!result)
+        {
+            flint_printf("FAIL (threaded):\n");
+            flint_printf("n = %wu, len = %wd\n", n, len);
+            abort();
+        }
+
+        nmod_poly_clear(a1);
+        nmod_poly_clear(a2);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
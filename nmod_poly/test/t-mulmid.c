@@ -0,0 +1,215 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+/* sets a to the coefficients len(c) - 1, ..., len(b) - 1 of b*c */
+static void
+_mulmid_naive(nmod_poly_t a, const nmod_poly_t b, const nmod_poly_t c)
+{
+    nmod_poly_t t;
+
+    if (c->length == 0 || b->length < c->length)
+    {
+        nmod_poly_zero(a);
+        return;
+    }
+
+    nmod_poly_init_preinv(t, b->mod.n, b->mod.ninv);
+    nmod_poly_mul(t, b, c);
+    nmod_poly_shift_right(t, t, c->length - 1);
+    nmod_poly_truncate(t, b->length - c->length + 1);
+    nmod_poly_swap(a, t);
+    nmod_poly_clear(t);
+}
+
+static void
+_check(const nmod_poly_t b, const nmod_poly_t c, int which)
+{
+    nmod_poly_t a, d;
+
+    nmod_poly_init_preinv(a, b->mod.n, b->mod.ninv);
+    nmod_poly_init_preinv(d, b->mod.n, b->mod.ninv);
+
+    _mulmid_naive(a, b, c);
+
+    if (which == 0)
+        nmod_poly_mulmid_classical(d, b, c);
+    else if (which == 1)
+        nmod_poly_mulmid_KS(d, b, c, 0);
+    else
+        nmod_poly_mulmid(d, b, c);
+
+    if (!nmod_poly_equal(a, d))
+    {
+        flint_printf("FAIL (%d):\n", which);
+        flint_printf("n = %wu, len1 = %wd, len2 = %wd\n",
+                     b->mod.n, b->length, c->length);
+        nmod_poly_print(a), flint_printf("\n\n");
+        nmod_poly_print(d), flint_printf("\n\n");
+        abort();
+    }
+
+    nmod_poly_clear(a);
+    nmod_poly_clear(d);
+}
+
+int
+main(void)
+{
+    int i, which, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mulmid....");
+    fflush(stdout);
+
+    /* Check aliasing of a with b and c */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b, c, d;
+        mp_limb_t n = n_randtest_not_zero(state);
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+        nmod_poly_init(d, n);
+        nmod_poly_randtest(b, state, n_randint(state, 100));
+        nmod_poly_randtest(c, state, n_randint(state, 100));
+        which = n_randint(state, 3);
+
+        nmod_poly_mulmid(a, b, c);
+
+        nmod_poly_set(d, b);
+        if (which == 0)
+            nmod_poly_mulmid_classical(d, d, c);
+        else if (which == 1)
+            nmod_poly_mulmid_KS(d, d, c, 0);
+        else
+            nmod_poly_mulmid(d, d, c);
+
+        result = nmod_poly_equal(a, d);
+
+        nmod_poly_set(d, c);
+        if (which == 0)
+            nmod_poly_mulmid_classical(d, b, d);
+        else if (which == 1)
+            nmod_poly_mulmid_KS(d, b, d, 0);
+        else
+            nmod_poly_mulmid(d, b, d);
+
+        result = result && nmod_poly_equal(a, d);
+        if (!result)
+        {
+            flint_printf("FAIL (aliasing, %d):\n", which);
+            nmod_poly_print(a), flint_printf("\n\n");
+            nmod_poly_print(d), flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+        nmod_poly_clear(d);
+    }
+
+    /*
+        Compare with mul, with lengths around the cutoffs of the dispatcher
+        and with both small and large moduli.
+    */
+    for (i = 0; i < 2000 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t b, c;
+        slong len1, len2;
+        mp_limb_t n;
+
+        if (n_randint(state, 2))
+            n = n_randtest_not_zero(state);
+        else
+            n = n_randint(state, 1000) + 1;
+
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+
+        switch (n_randint(state, 4))
+        {
+            case 0:  /* len2 <= 6 */
+                len2 = n_randint(state, 9) + 1;
+                len1 = len2 + n_randint(state, 40);
+                break;
+            case 1:  /* len1 - len2 < 6 */
+                len2 = n_randint(state, 40) + 1;
+                len1 = len2 + n_randint(state, 9);
+                break;
+            case 2:  /* len2 * (len1 - len2 + 1) around 8192 or 65536 */
+                len2 = n_randint(state, 300) + 7;
+                len1 = (n_randint(state, 2) ? 8192 : 65536) / len2;
+                len1 = len2 + len1 + n_randint(state, 5) - 3;
+                break;
+            default:
+                len2 = n_randint(state, 200) + 1;
+                len1 = len2 + n_randint(state, 200);
+        }
+
+        nmod_poly_randtest(b, state, len1);
+        nmod_poly_randtest(c, state, len2);
+
+        for (which = 0; which < 3; which++)
+            _check(b, c, which);
+
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+    }
+
+    /*
+        Check either side of NMOD_POLY_MULMID_FFT_CUTOFF, where the cyclic
+        FFT is used, with small and large moduli
+    */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t b, c;
+        slong len1, len2, bits;
+        mp_limb_t n;
+
+        if (n_randint(state, 2))
+            n = n_randint(state, 16) + 2;
+        else
+            n = n_randtest_not_zero(state);
+
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+
+        len2 = n_randint(state, 2000) + 1;
+        bits = 2 * FLINT_BIT_COUNT(n) + FLINT_BIT_COUNT(len2);
+        len1 = (NMOD_POLY_MULMID_FFT_CUTOFF * FLINT_BITS) / bits;
+        len1 = len1 + n_randint(state, 400) - 200;
+        len1 = FLINT_MAX(len1, len2);
+
+        nmod_poly_randtest(b, state, len1);
+        nmod_poly_randtest(c, state, len2);
+
+        _check(b, c, 1);
+        _check(b, c, 2);
+
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mulmod_precomp....");
+    fflush(stdout);
+
+    /* Check against mulmod, with aliasing */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b, res1, res2, f, finv;
+        nmod_poly_rem_precomp_t P;
+        slong len;
+
+        mp_limb_t n = n_randtest_prime(state, 0);
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(f, n);
+        nmod_poly_init(finv, n);
+        nmod_poly_init(res1, n);
+        nmod_poly_init(res2, n);
+
+        len = n_randint(state, 50) + 1;
+        if (n_randint(state, 20) == 0) /* use the FFT */
+            len = (NMOD_POLY_REM_PRECOMP_CUTOFF*FLINT_BITS)/
+                  (2*FLINT_BIT_COUNT(n)) + n_randint(state, 1000) + 1;
+
+        do {
+            nmod_poly_randtest(f, state, len);
+        } while (nmod_poly_is_zero(f));
+
+        nmod_poly_reverse(finv, f, f->length);
+        nmod_poly_inv_series(finv, finv, f->length);
+
+        nmod_poly_rem_precomp_init(P, f, finv);
+
+        /* use each context several times */
+        for (j = 0; j < 3; j++)
+        {
+            nmod_poly_randtest(a, state, n_randint(state, f->length));
+            nmod_poly_randtest(b, state, n_randint(state, f->length));
+
+            nmod_poly_mulmod(res1, a, b, f);
+
+            switch (n_randint(state, 3))
+            {
+                case 0:
+                    nmod_poly_mulmod_precomp(res2, a, b, P);
+                    break;
+                case 1:
+                    nmod_poly_set(res2, a);
+                    nmod_poly_mulmod_precomp(res2, res2, b, P);
+                    break;
+                default:
+                    nmod_poly_set(res2, b);
+                    nmod_poly_mulmod_precomp(res2, a, res2, P);
+            }
+
+            result = (nmod_poly_equal(res1, res2));
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("n = %wu, len = %wd, j = %d\n", n, f->length, j);
+                flint_printf("a:\n"); nmod_poly_print(a), flint_printf("\n\n");
+                flint_printf("b:\n"); nmod_poly_print(b), flint_printf("\n\n");
+                flint_printf("f:\n"); nmod_poly_print(f), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        nmod_poly_rem_precomp_clear(P);
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(f);
+        nmod_poly_clear(finv);
+        nmod_poly_clear(res1);
+        nmod_poly_clear(res2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
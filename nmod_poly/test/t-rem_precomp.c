@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rem_precomp....");
+    fflush(stdout);
+
+    /* Check against rem, with aliasing */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, r1, r2, f, finv;
+        nmod_poly_rem_precomp_t P;
+        slong len;
+
+        mp_limb_t n = n_randtest_prime(state, 0);
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(f, n);
+        nmod_poly_init(finv, n);
+        nmod_poly_init(r1, n);
+        nmod_poly_init(r2, n);
+
+        len = n_randint(state, 50) + 2;
+        if (n_randint(state, 20) == 0) /* use the FFT */
+            len = (NMOD_POLY_REM_PRECOMP_CUTOFF*FLINT_BITS)/
+                  (2*FLINT_BIT_COUNT(n)) + n_randint(state, 2000) + 2;
+
+        do {
+            nmod_poly_randtest(f, state, len);
+        } while (f->length < 2);
+
+        nmod_poly_reverse(finv, f, f->length);
+        nmod_poly_inv_series(finv, finv, f->length);
+
+        nmod_poly_rem_precomp_init(P, f, finv);
+
+        for (j = 0; j < 3; j++)
+        {
+            nmod_poly_randtest(a, state, n_randint(state, 2*f->length - 2));
+
+            nmod_poly_rem(r1, a, f);
+
+            if (n_randint(state, 2))
+            {
+                nmod_poly_rem_precomp(r2, a, P);
+            } else
+            {
+                nmod_poly_set(r2, a);
+                nmod_poly_rem_precomp(r2, r2, P);
+            }
+
+            result = (nmod_poly_equal(r1, r2));
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("n = %wu, lenf = %wd, lena = %wd\n",
+                                                  n, f->length, a->length);
+                abort();
+            }
+        }
+
+        nmod_poly_rem_precomp_clear(P);
+        nmod_poly_clear(a);
+        nmod_poly_clear(f);
+        nmod_poly_clear(finv);
+        nmod_poly_clear(r1);
+        nmod_poly_clear(r2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*
+    Copyright (C) 2026 agent
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void nmod_poly_tree_init(nmod_poly_tree_t T,
+                                      mp_srcptr xs, slong len, mp_limb_t n)
+{
+    slong i, height, pow;
+    mp_ptr t;
+
+    nmod_init(&T->mod, n);
+    T->length = len;
+    T->tree = _nmod_poly_tree_alloc(len);
+    T->root = NULL;
+    T->rootinv = NULL;
+    T->weights = NULL;
+
+    if (len == 0)
+        return;
+
+    _nmod_poly_tree_build(T->tree, xs, len, T->mod);
+
+    /* the product of all the nodes and the inverse of its reverse */
+    T->root = _nmod_vec_init(len + 1);
+    T->rootinv = _nmod_vec_init(len);
+
+    height = FLINT_CLOG2(len);
+
+    if (len == 1)
+        _nmod_vec_set(T->root, T->tree[0], 2);
+    else
+    {
+        pow = WORD(1) << (height - 1);
+        _nmod_poly_mul(T->root, T->tree[height - 1], pow + 1,
+                       T->tree[height - 1] + (pow + 1), len - pow + 1, T->mod);
+    }
+
+    t = _nmod_vec_init(len + 1);
+    _nmod_poly_reverse(t, T->root, len + 1, len + 1);
+    _nmod_poly_inv_series(T->rootinv, t, len + 1, len, T->mod);
+
+    /*
+       interpolation weights 1 / prod_{j != i} (x_i - x_j), which exist
+       only if every product is a unit (for prime n, the points distinct)
+    */
+    if (len == 1)
+    {
+        T->weights = _nmod_vec_init(1);
+        T->weights[0] = 1;
+    }
+    else
+    {
+        mp_ptr w = _nmod_vec_init(len);
+        mp_srcptr tp = t;
+
+        _nmod_poly_derivative(t, T->root, len + 1, T->mod);
+        _nmod_poly_evaluate_nmod_vec_tree_vec(&w, &tp, &len, 1, T);
+
+        for (i = 0; i < len; i++)
+        {
+            if (w[i] == 0 || n_gcdinv(w + i, w[i], T->mod.n) != 1)
+                break;
+        }
+
+        if (i == len)
+            T->weights = w;
+        else
+            _nmod_vec_clear(w);
+    }
+
+    _nmod_vec_clear(t);
+}
+
+void nmod_poly_tree_clear(nmod_poly_tree_t T)
+{
+    if (T->length != 0)
+    {
+        _nmod_vec_clear(T->root);
+        _nmod_vec_clear(T->rootinv);
+
+        if (T->weights != NULL)
+            _nmod_vec_clear(T->weights);
+    }
+
+    _nmod_poly_tree_free(T->tree, T->length);
+}
@@ -84,6 +84,12 @@ FLINT_DLL void thread_pool_give_back(thread_pool_t T, thread_pool_handle i);
 
 FLINT_DLL void thread_pool_clear(thread_pool_t T);
 
+FLINT_DLL slong flint_request_threads(thread_pool_handle ** handles,
+                                                         slong thread_limit);
+
+FLINT_DLL void flint_give_back_threads(thread_pool_handle * handles,
+                                                          slong num_handles);
+
 #ifdef __cplusplus
 }
 #endif
@@ -45,6 +45,45 @@ void flint_set_num_threads(int num_threads)
 #endif
 }
 
+/*
+    Request up to thread_limit - 1 workers from the global thread pool and
+    return the number obtained. The handles must be returned with
+    flint_give_back_threads.
+*/
+slong flint_request_threads(thread_pool_handle ** handles, slong thread_limit)
+{
+    slong max_num_handles, num_handles = 0;
+
+    *handles = NULL;
+
+    if (global_thread_pool_initialized && thread_limit > 1)
+    {
+        max_num_handles = thread_pool_get_size(global_thread_pool);
+        max_num_handles = FLINT_MIN(thread_limit - 1, max_num_handles);
+
+        if (max_num_handles > 0)
+        {
+            *handles = (thread_pool_handle *) flint_malloc(
+                                   max_num_handles*sizeof(thread_pool_handle));
+            num_handles = thread_pool_request(global_thread_pool,
+                                                    *handles, max_num_handles);
+        }
+    }
+
+    return num_handles;
+}
+
+void flint_give_back_threads(thread_pool_handle * handles, slong num_handles)
+{
+    slong i;
+
+    for (i = 0; i < num_handles; i++)
+        thread_pool_give_back(global_thread_pool, handles[i]);
+
+    if (handles != NULL)
+        flint_free(handles);
+}
+
 /* return zero for success, nonzero for error */
 int flint_set_thread_affinity(int * cpus, slong length)
 {